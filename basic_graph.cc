@@ -1,49 +1,48 @@
 #include "basic_graph.h"
+#include "graph_text.h"
+#include "graph_compress.h"
+#include "graph_io.h"
+#include "graph_sets.h"
+#include "graph_order.h"
 #include <fstream>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <sstream>
 
 const int kBinaryLoadingRate=65536;
+//Reverse transposes 2^kReverseBucketBits destinations at a time
+const int kReverseBucketBits=15;
 
 template<class T>
-static void ArraySet(T * &a, int n=0){
-  if (a)
-    delete a;
-  if (n){
-    a=new T[n];
-    memset(a, 0, n * sizeof(T) );
-  }
-  else
-    a=0;
-}
-
-template<class T>
-static void LoadBinaryFile(const std::string& path, std::ifstream& stream, int size, int * &array, bool verbose){
+static void LoadBinaryFile(const std::string& path, std::ifstream& stream, long long size, T * array, bool verbose){
   mProcess load_process("Load of binary file " + path, size, verbose);
   load_process.Start();
-  ArraySet(array, size);
-  for(int i=0; i<size; i+=kBinaryLoadingRate){
-    stream.read( reinterpret_cast<char*>( array + i ) , sizeof(T) * kBinaryLoadingRate );
+  for(long long i=0; i<size; i+=kBinaryLoadingRate){
+    long long t = std::min<long long>( kBinaryLoadingRate, size - i );
+    stream.read( reinterpret_cast<char*>( array + i ) , sizeof(T) * t );
     load_process.Update(i);
   }
   load_process.Stop();
 }
 
 template<class T>
-static void SaveBinaryFile(const std::string& path, std::ofstream& stream, int size, const int * array, bool verbose){
-  mProcess save_process("Save of binary file " + path, size, verbose);
-  save_process.Start();
-  for(int i=0; i<size; i+=kBinaryLoadingRate){
-    int t = std::min( kBinaryLoadingRate, size - i );
-    stream.write( reinterpret_cast<const char*> ( array + i ) , sizeof(T) * t );
-    save_process.Update(i);
+static T* MapBinaryFile(const std::string& path, long long size, MemoryBlock& block, const int parameter, bool verbose){
+  mProcess map_process("Mapping of binary file " + path, size, verbose);
+  map_process.Start();
+  block = GraphMemory::MapFile(path, parameter & kPopulate, parameter & kWillNeed);
+  if ( block.length < sizeof(T) * size ){
+    GraphMemory::Release(block);
+    throw std::runtime_error("Truncated binary file " + path);
   }
-  save_process.Stop();
+  map_process.Stop();
+  return static_cast<T*>(block.address);
 }
 
 template<class T>
-static void LoadTextFile(const std::string& path, std::ifstream& stream, int size, int * &array, bool verbose){
+static void LoadTextFile(const std::string& path, std::ifstream& stream, int size, T * array, bool verbose){
   mProcess load_process("Load of text file " + path, size, verbose);
   load_process.Start();
-  ArraySet(array, size);
   for(int i=0; i<size; i++){
     stream >> array[i];
     load_process.Update(i);
@@ -51,19 +50,103 @@ static void LoadTextFile(const std::string& path, std::ifstream& stream, int siz
   load_process.Stop();
 }
 
-template<class T>
-static void SaveTextFile(const std::string& path, std::ofstream& stream, int size, const int * array, bool verbose){
-  mProcess save_process("Save of text file " + path, size, verbose);
-  save_process.Start();
-  for(int i=0; i<size; i++){
-    stream << array[i] << "\n" ;
-    save_process.Update(i);
+static bool SortedNeighbors(const EdgeOffsets& boundaries, const int *targets, int number_vertex){
+  for(int i=0; i<number_vertex; i++)
+    for(long long j=boundaries.Start(i)+1; j<boundaries[i]; j++)
+      if (targets[j-1] > targets[j])
+        return 0;
+  return 1;
+}
+
+//inverse[permutation[i]] = i, false when permutation is not one of 0..size-1
+static bool InvertPermutation(const int *permutation, int size, int *inverse){
+  std::vector<char> valid(mParallel::Threads(), 1);
+  mParallel::For(0, size, [&](int thread_id, long long begin, long long end){
+      for(long long i=begin; i<end; i++)
+        if (permutation[i] < 0 || permutation[i] >= size)
+          valid[thread_id] = 0;
+    });
+  if (std::find(valid.begin(), valid.end(), 0) != valid.end())
+    return 0;
+  mParallel::For(0, size, [&](int thread_id, long long begin, long long end){
+      for(long long i=begin; i<end; i++)
+        __atomic_store_n(&inverse[ permutation[i] ], i, __ATOMIC_RELAXED);
+    });
+  //a repeated value leaves one of its positions behind
+  mParallel::For(0, size, [&](int thread_id, long long begin, long long end){
+      for(long long i=begin; i<end; i++)
+        if (__atomic_load_n(&inverse[ permutation[i] ], __ATOMIC_RELAXED) != i)
+          valid[thread_id] = 0;
+    });
+  return std::find(valid.begin(), valid.end(), 0) == valid.end();
+}
+
+//the mapping and its index are the only sections outside of the views,
+//an index must leave a slot empty for the probes to stop
+static bool KnownSection(const GraphSection& section, long long number_vertex){
+  if (section.view < BAD)
+    return 1;
+  if (section.view != BAD)
+    return 0;
+  if (section.kind == kIdIndexSection)
+    return section.count == IdIndex::Capacity(number_vertex);
+  return section.kind == kMappingSection;
+}
+
+//the counts the sections of a container must agree on before any array is
+//read: vertex ids fit an int, every per-vertex section has a slot for each
+//vertex and a view is either plain or compressed, with all of its sections
+static void CheckSectionCounts(const GraphFileHeader& header, const GraphSection *sections, const std::string& path){
+  if ( header.number_vertex > static_cast<uint64_t>( std::numeric_limits<int>::max() ) )
+    throw std::runtime_error("Corrupted section in " + path);
+  uint32_t kinds[BAD] = { 0, 0, 0, 0 };
+  for(uint32_t i=0; i<header.number_sections; i++){
+    const GraphSection& section=sections[i];
+    if ( ( section.kind == kBoundarySection || section.kind == kMappingSection ) && section.count != header.number_vertex )
+      throw std::runtime_error("Corrupted section in " + path);
+    if ( section.kind == kOffsetSection && section.count != header.number_vertex + 1 )
+      throw std::runtime_error("Corrupted section in " + path);
+    if (section.view < BAD){
+      if ( kinds[section.view] & ( 1U << section.kind ) )
+        throw std::runtime_error("Corrupted section in " + path);
+      kinds[section.view] |= 1U << section.kind;
+    }
   }
-  save_process.Stop();
+  const uint32_t plain = 1U << kBoundarySection | 1U << kTargetSection;
+  const uint32_t compressed = 1U << kBoundarySection | 1U << kOffsetSection | 1U << kCompressedSection;
+  for(int i=0; i<BAD; i++)
+    if (kinds[i] && kinds[i] != plain && kinds[i] != compressed)
+      throw std::runtime_error("Corrupted section in " + path);
+}
+
+//memcpy in blocks spread over the threads
+static void CopyInParallel(void *to, const void *from, uint64_t length){
+  const uint64_t kCopyBlock = 1 << 22;
+  mParallel::For(0, ( length + kCopyBlock - 1 ) / kCopyBlock, [&](int thread_id, long long begin, long long end){
+      for(long long b=begin; b<end; b++){
+        uint64_t offset = b * kCopyBlock;
+        memcpy(static_cast<char*>(to) + offset, static_cast<const char*>(from) + offset, std::min(kCopyBlock, length - offset));
+      }
+    });
+}
+
+//calls func(thread_id, vertex_begin, vertex_end) on vertex blocks holding about the same number of edges
+template<class F>
+static void ForEachVertexBlock(const EdgeOffsets& boundaries, int number_vertex, F func){
+  long long number_edges = number_vertex ? boundaries[number_vertex-1] : 0;
+  int threads = mParallel::Threads();
+  mParallel::Run(threads, [&](int thread_id){
+      long long first_edge = number_edges * thread_id / threads;
+      long long last_edge = number_edges * ( thread_id + 1 ) / threads;
+      int begin = thread_id ? boundaries.UpperBound(number_vertex, first_edge) : 0;
+      int end = thread_id + 1 < threads ? boundaries.UpperBound(number_vertex, last_edge) : number_vertex;
+      func(thread_id, begin, end);
+    });
 }
 
 BasicGraph::BasicGraph(bool verbose):
-  number_vertex_(0), number_edges_(0), verbose_(verbose){
+  number_vertex_(0), number_edges_(0), to_raw_(0), numa_placement_(kNumaFirstTouch), numa_nodes_(1),
+  undirected_(0), verbose_(verbose){
   
 }
 
@@ -72,72 +155,194 @@ BasicGraph::BasicGraph(const std::string& base_path, bool verbose):
   Load(base_path);
 }
 
-BasicGraph::~BasicGraph(){
+BasicGraph::BasicGraph(const BasicGraph& graph, const std::vector<int>& subgraph_ids, bool raw, bool verbose):
+  BasicGraph(verbose){
+  mProcess extract_process("Induced subgraph extraction", 1, verbose_);
+  extract_process.Start();
+  graph.Materialize(OUT);
+  int parent_vertex = graph.number_vertex_;
+
+  //membership bitmap, the new id of a member is the number of members before it
+  long long words = ( static_cast<long long>(parent_vertex) + 63 ) / 64;
+  std::vector<uint64_t> members(words, 0);
+  std::vector<char> valid(mParallel::Threads(), 1);
+  mParallel::For(0, subgraph_ids.size(), [&](int thread_id, long long begin, long long end){
+      for(long long i=begin; i<end; i++){
+        long long id = raw ? graph.FromRawId(subgraph_ids[i]) : subgraph_ids[i];
+        if (id < 0 || id >= parent_vertex)
+          valid[thread_id] = 0;
+        else
+          __atomic_fetch_or(&members[id >> 6], 1ULL << ( id & 63 ), __ATOMIC_RELAXED);
+      }
+    });
+  if (std::find(valid.begin(), valid.end(), 0) != valid.end())
+    throw std::runtime_error("A subgraph vertex is not in the graph");
+  std::vector<int> ranks(words + 1, 0);
+  mParallel::For(0, words, [&](int thread_id, long long begin, long long end){
+      for(long long w=begin; w<end; w++)
+        ranks[w+1] = __builtin_popcountll(members[w]);
+    });
+  mParallel::PrefixSum(&ranks[0] + 1, words);
+  number_vertex_ = ranks[words];
+  auto member = [&](int vertex){ return ( members[vertex >> 6] >> ( vertex & 63 ) ) & 1; };
+  auto new_id = [&](int vertex){
+    return ranks[vertex >> 6] + __builtin_popcountll( members[vertex >> 6] & ( ( 1ULL << ( vertex & 63 ) ) - 1 ) );
+  };
+  MemoryBlock old_ids_block = GraphMemory::Allocate( sizeof(int) * number_vertex_ );
+  int *old_ids = static_cast<int*>(old_ids_block.address);
+  mParallel::For(0, words, [&](int thread_id, long long begin, long long end){
+      for(long long w=begin; w<end; w++){
+        int position = ranks[w];
+        for(uint64_t bits = members[w]; bits; bits &= bits - 1)
+          old_ids[ position++ ] = w * 64 + __builtin_ctzll(bits);
+      }
+    });
 
+  //every list keeps its members, renamed, in the same order
+  undirected_ = graph.undirected_;
+  GraphType types[]={OUT, IN, INTERSECTION, UNION};
+  MemoryBlock counts_block = GraphMemory::Allocate( sizeof(long long) * number_vertex_ );
+  long long *counts = static_cast<long long*>(counts_block.address);
+  for(int i=0; i<BAD; i++){
+    graph.WaitForView(types[i]);
+    const BasicGraphImpl &source=graph.graphs_[i];
+    if (!source.IsReady())
+      continue;
+    BasicGraphImpl &g=graphs_[i];
+    mParallel::For(0, number_vertex_, [&](int thread_id, long long begin, long long end){
+        for(long long v=begin; v<end; v++){
+          long long count = 0;
+          for(NeighborIterator it = graph.GetNeighborIterator(old_ids[v], types[i]); it.HasNext(); )
+            count += member( it.Next() );
+          counts[v] = count;
+        }
+      });
+    mParallel::PrefixSum(counts, number_vertex_);
+    g.number_edges = number_vertex_ ? counts[number_vertex_-1] : 0;
+    g.AllocateBoundaries(number_vertex_, EdgeOffsets::NeedsWide(g.number_edges));
+    mParallel::For(0, number_vertex_, [&](int thread_id, long long begin, long long end){
+        for(long long v=begin; v<end; v++)
+          g.boundaries.Set(v, counts[v]);
+      });
+    g.AllocateTargets(g.number_edges);
+    ForEachVertexBlock(g.boundaries, number_vertex_, [&](int thread_id, int begin, int end){
+        for(int v=begin; v<end; v++){
+          int *target = g.targets + g.boundaries.Start(v);
+          for(NeighborIterator it = graph.GetNeighborIterator(old_ids[v], types[i]); it.HasNext(); ){
+            int u = it.Next();
+            if (member(u))
+              *target++ = new_id(u);
+          }
+        }
+      });
+    g.sorted = source.compressed.offsets ? source.compressed.sorted : source.sorted;
+    g.Publish();
+  }
+  GraphMemory::Release(counts_block);
+  number_edges_ = graphs_[ static_cast<int>(OUT) ].number_edges;
+
+  //the raw id of a new vertex is that of the old one
+  MemoryBlock to_raw_block = GraphMemory::Allocate( sizeof(long long) * number_vertex_ );
+  long long *to_raw = static_cast<long long*>(to_raw_block.address);
+  mParallel::For(0, number_vertex_, [&](int thread_id, long long begin, long long end){
+      for(long long v=begin; v<end; v++)
+        to_raw[v] = graph.ToRawId(old_ids[v]);
+    });
+  GraphMemory::Release(old_ids_block);
+  BindMapping(to_raw, to_raw_block);
+  IndexMapping();
+  extract_process.Stop();
+}
+
+BasicGraph::BasicGraph(const BasicGraph& graph, const std::vector<long long>& raw_ids, bool verbose):
+  BasicGraph(graph, graph.FromRawIds(raw_ids), 0, verbose){
+}
+
+BasicGraph::~BasicGraph(){
+  Clear();
 }
 
 void BasicGraph::Clear(){
+  WaitForLoads();
   number_edges_=0;
   number_vertex_=0;
+  undirected_=0;
+  ResetPlacement();
   for(int i=0; i<BAD; i++)
     graphs_[i].Clear();
+  BindMapping(0, MemoryBlock());
+  GraphMemory::Release(image_block_);
 }
 
-void BasicGraph::Load(const std::string& base_path){
+void BasicGraph::Load(const std::string& base_path, const int parameter){
   Clear();
-  
-  std::string index_name( base_path + ".ind" );
-  std::ifstream index_stream( index_name );
-  FilePath::CheckForOpen(index_name, index_stream);
-  index_stream >> number_vertex_ >> number_edges_;
 
-  try{
-    LoadImpl(base_path, OUT, 0);
-    try{
-      LoadImpl(base_path, IN, 0);
-    } catch(std::runtime_error &e){
-      Generate(IN);
-    }
-    try{
-      LoadImpl(base_path, INTERSECTION, 0);
-    } catch(std::runtime_error &e){
-      Generate(INTERSECTION);
-    }
-    try{
-      LoadImpl(base_path, UNION, 0);
-    } catch(std::runtime_error &e){
-      Generate(UNION);
-    }
+  std::string container_name( base_path + kContainerSuffix );
+  if (FilePath::Exist(container_name)){
+    LoadContainer(container_name, parameter);
+    return;
+  }
+  
+  LoadIndex(base_path);
+  LoadMapping(base_path, parameter);
+  LoadViews(base_path, parameter);
+}
 
-  }catch(std::runtime_error &e){
+std::shared_future<void> BasicGraph::LoadAsync(const std::string& base_path, const int parameter){
+  Clear();
 
-    LoadImpl(base_path, OUT, kBinary);
-    try{
-      LoadImpl(base_path, IN, kBinary);
-    } catch(std::runtime_error &e){
-      Generate(IN);
-    }
-    try{
-      LoadImpl(base_path, INTERSECTION, kBinary);
-    } catch(std::runtime_error &e){
-       Generate(INTERSECTION);
-    }
-    try{
-      LoadImpl(base_path, UNION, kBinary);
-    } catch(std::runtime_error &e){
-      Generate(UNION);
-    }
+  std::string container_name( base_path + kContainerSuffix );
+  bool container = FilePath::Exist(container_name);
+  if (container && (parameter & kMapped)){
+    //nothing is read, the views are resident once the image is attached
+    LoadContainer(container_name, parameter);
+    std::promise<void> loaded;
+    loaded.set_value();
+    return loaded.get_future().share();
+  }
 
+  std::vector<GraphSection> sections;
+  if (container){
+    sections = LoadSectionTable(container_name);
+    LoadContainerView(container_name, sections, BAD);
+    IndexMapping();
+  }else{
+    LoadIndex(base_path);
+    LoadMapping(base_path, parameter);
+  }
+  GraphType types[]={OUT, IN, INTERSECTION, UNION};
+  for(int i=0; i<BAD; i++){
+    GraphType type = types[i];
+    if (container)
+      pending_[i] = std::async(std::launch::async, [=](){ LoadContainerView(container_name, sections, type); }).share();
+    else
+      pending_[i] = std::async(std::launch::async, [=](){ LoadView(base_path, type, parameter); }).share();
   }
+  std::vector< std::shared_future<void> > views(pending_, pending_ + BAD);
+  return std::async(std::launch::async, [views](){
+      for(size_t i=0; i<views.size(); i++)
+        views[i].get();
+    }).share();
 }
 
-void BasicGraph::Save(const std::string& base_path, const int parameter)const{
-  if (parameter & kIndex){
-    std::string index_name( base_path + ".ind" );
-    FilePath::CheckForExistence(index_name);
-    std::ofstream index_stream(index_name);
-    FilePath::CheckForCreation(index_name, index_stream);
-    index_stream << number_vertex_ << "\n" << number_edges_ << "\n";
+void BasicGraph::LoadIndex(const std::string& base_path){
+  std::string index_name( base_path + ".ind" );
+  std::ifstream index_stream( index_name );
+  FilePath::CheckForOpen(index_name, index_stream);
+  index_stream >> number_vertex_ >> number_edges_;
+  //the GraphFileHeader flags follow in files written since they exist
+  uint32_t flags = 0;
+  if ( !(index_stream >> flags) )
+    flags = 0;
+  undirected_ = flags & kGraphUndirected;
+}
+
+void BasicGraph::Save(const std::string& base_path, const int saved_parameter)const{
+  const int parameter = SavedViews(saved_parameter);
+  MaterializeViews(parameter);
+  if (parameter & kContainer){
+    SaveContainer(base_path + kContainerSuffix, parameter);
+    return;
   }
   if (parameter & kIn){
     SaveImpl(base_path, IN, parameter);
@@ -151,53 +356,201 @@ void BasicGraph::Save(const std::string& base_path, const int parameter)const{
   if (parameter & kUnion){
     SaveImpl(base_path, UNION, parameter);
   }
+  if ( (parameter & kMapping) && to_raw_ ){
+    SaveMapping(base_path, parameter);
+  }
+  if (parameter & kIndex){
+    //the index is published last, Load starts from it
+    AtomicFile index_file(base_path + ".ind", parameter & kOverwrite);
+    std::ostringstream index_stream;
+    index_stream << number_vertex_ << "\n" << number_edges_ << "\n" << ( undirected_ ? kGraphUndirected : 0 ) << "\n";
+    index_file.Write(0, index_stream.str().data(), index_stream.str().size());
+    index_file.Commit();
+  }
 }
 
-void BasicGraph::GenerateRMATGraph(int n_scale, double edge_factor, double a, double b, double c){
-  srand(time(0));
-  
-  int n = ( 1 << n_scale );
-  int m = static_cast<int> ( n * ( n - 1) * edge_factor );
-  double ab=a+b, abc=ab+c;
-  std::vector< std::vector<int> > adj_edge(n);
-  for(int edge_num=0; edge_num < m; edge_num++){
-    int s=0, t=0;
-    for(int iter_times=0; iter_times < n_scale; iter_times++){
-      double rand_factor=RandUnity();
-      if (rand_factor<a){
-        //pass
-      }else
-        if (rand_factor<ab){
-          t += ( 1 << ( n_scale - 1 - iter_times ) );
-        }else
-          if (rand_factor<abc){
-            s += ( 1 << ( n_scale - 1 - iter_times ) );
-          }else{
-            s += ( 1 << ( n_scale - 1 - iter_times ) );
-            t += ( 1 << ( n_scale - 1 - iter_times ) );
-          }
-    }
-    adj_edge[s].push_back(t);
+void BasicGraph::LoadEdgeList(const std::string& path, const int parameter){
+  if (parameter & kSparseIds){
+    LoadSparseEdgeList(path, parameter);
+    return;
+  }
+  std::vector<int> sources, targets;
+  EdgeListInfo info = TextParser::ParseEdgeFile(path, sources, targets, verbose_);
+  long long number_edges = sources.size();
+
+  //vertices are numbered by the header if there is one, by the largest id otherwise
+  std::vector<int> max_ids(mParallel::Threads(), -1), min_ids(mParallel::Threads(), 0);
+  mParallel::For(0, number_edges, [&](int thread_id, long long begin, long long end){
+      for(long long i=begin; i<end; i++){
+        max_ids[thread_id] = std::max(max_ids[thread_id], std::max(sources[i], targets[i]));
+        min_ids[thread_id] = std::min(min_ids[thread_id], std::min(sources[i], targets[i]));
+      }
+    });
+  int max_id = *std::max_element(max_ids.begin(), max_ids.end());
+  int min_id = *std::min_element(min_ids.begin(), min_ids.end());
+  //ids past INT_MAX were parsed as -1, those of sparse graphs need kSparseIds
+  if (min_id < 0 || ( info.number_vertex >= 0 && max_id >= info.number_vertex ))
+    throw std::runtime_error("Vertex id out of range in " + path + ", load 64-bit ids with kSparseIds");
+  int number_vertex = info.number_vertex >= 0 ? info.number_vertex : max_id + 1;
+
+  AssignEdges(number_vertex, sources.data(), targets.data(), number_edges, parameter);
+}
+
+void BasicGraph::LoadSparseEdgeList(const std::string& path, const int parameter){
+  std::vector<long long> raw_sources, raw_targets;
+  TextParser::ParseEdgeFile(path, raw_sources, raw_targets, verbose_);
+  long long number_edges = raw_sources.size();
+
+  //vertex i is the i-th smallest key, the keys are indexed before CSR
+  //construction to translate the edges and kept as the mapping afterwards
+  std::vector<long long> keys(raw_sources);
+  keys.insert(keys.end(), raw_targets.begin(), raw_targets.end());
+  keys = IdIndex::Unique( std::move(keys) );
+  //keys past the range of long long were parsed as -1
+  if (!keys.empty() && keys[0] < 0)
+    throw std::runtime_error("Vertex id out of range in " + path);
+  if ( keys.size() > static_cast<size_t>( std::numeric_limits<int>::max() ) )
+    throw std::runtime_error("Too many vertices in " + path);
+  int number_vertex = keys.size();
+  MemoryBlock to_raw_block = GraphMemory::Allocate( sizeof(long long) * number_vertex );
+  long long *to_raw = static_cast<long long*>(to_raw_block.address);
+  std::copy(keys.begin(), keys.end(), to_raw);
+  std::vector<long long>().swap(keys);
+  uint64_t capacity = IdIndex::Capacity(number_vertex);
+  MemoryBlock index_block = GraphMemory::Allocate( sizeof(IdSlot) * capacity );
+  IdIndex::Build(to_raw, number_vertex, static_cast<IdSlot*>(index_block.address));
+  IdIndex index;
+  index.Bind(static_cast<IdSlot*>(index_block.address), capacity);
+
+  std::vector<int> sources(number_edges), targets(number_edges);
+  index.FindAll(raw_sources.data(), number_edges, sources.data());
+  std::vector<long long>().swap(raw_sources);
+  index.FindAll(raw_targets.data(), number_edges, targets.data());
+  std::vector<long long>().swap(raw_targets);
+  try{
+    AssignEdges(number_vertex, sources.data(), targets.data(), number_edges, parameter);
+  }catch(...){
+    GraphMemory::Release(to_raw_block);
+    GraphMemory::Release(index_block);
+    throw;
   }
+  BindMapping(to_raw, to_raw_block);
+  BindIndex(static_cast<IdSlot*>(index_block.address), capacity, index_block);
+}
+
+void BasicGraph::AssignEdges(int number_vertex, const int *sources, const int *targets, long long number_edges, const int parameter){
+  mProcess assign_process("CSR construction from edge list", 1, verbose_);
+  assign_process.Start();
   Clear();
-  number_vertex_ = n;
-  number_edges_ = m;
-  BasicGraphImpl& g=graphs_[ static_cast<int> ( OUT ) ];
-  g.generated=1;
-  g.number_edges = m;
-  ArraySet(g.boundaries, n);
-  ArraySet(g.targets, m);
-  for(int i=0; i<n; i++){
-    sort( adj_edge[i].begin(), adj_edge[i].end() );
-    adj_edge[i].resize( unique(adj_edge[i].begin(), adj_edge[i].end()) - adj_edge[i].begin());
-    int last_bound = ( i ? g.boundaries[i-1] : 0 );
-    g.boundaries[i] = last_bound + adj_edge[i].size();
-    for(int j=0; j != adj_edge[i].size(); j++)
-      g.targets[ last_bound + j ] = adj_edge[i][j];
-  }
-  Generate(IN);
-  Generate(INTERSECTION);
-  Generate(UNION);
+  number_vertex_ = number_vertex;
+  BasicGraphImpl &g=graphs_[ static_cast<int>(OUT) ];
+  bool keep_loops = !(parameter & kNoSelfLoops);
+  //an undirected edge is scattered from both ends, the copies are merged below
+  bool undirected = parameter & kUndirected;
+
+  //count the out degrees, then turn them into boundaries, 64-bit ones once
+  //the edges may not fit an int. a cursor starts at the beginning of its list
+  //and every edge is scattered to the next free slot of its source
+  bool wide = (parameter & kWideOffsets) || EdgeOffsets::NeedsWide( undirected ? 2 * number_edges : number_edges );
+  MemoryBlock cursor_block = GraphMemory::Allocate( sizeof(long long) * number_vertex );
+  long long *cursor = static_cast<long long*>(cursor_block.address);
+  std::vector<long long> kept(mParallel::Threads(), 0);
+  mParallel::For(0, number_edges, [&](int thread_id, long long begin, long long end){
+      for(long long i=begin; i<end; i++)
+        if ( keep_loops || sources[i] != targets[i] ){
+          __atomic_fetch_add(&cursor[ sources[i] ], 1, __ATOMIC_RELAXED);
+          kept[thread_id]++;
+          if (undirected){
+            __atomic_fetch_add(&cursor[ targets[i] ], 1, __ATOMIC_RELAXED);
+            kept[thread_id]++;
+          }
+        }
+    });
+  long long kept_edges = 0;
+  for(auto count: kept)
+    kept_edges += count;
+  mParallel::PrefixSum(cursor, number_vertex);
+  g.AllocateBoundaries(number_vertex, wide);
+  mParallel::For(0, number_vertex, [&](int thread_id, long long begin, long long end){
+      for(long long i=begin; i<end; i++)
+        g.boundaries.Set(i, cursor[i]);
+    });
+  mParallel::For(0, number_vertex, [&](int thread_id, long long begin, long long end){
+      for(long long i=begin; i<end; i++)
+        cursor[i] = g.boundaries.Start(i);
+    });
+  g.AllocateTargets(kept_edges);
+  g.number_edges = kept_edges;
+  mParallel::For(0, number_edges, [&](int thread_id, long long begin, long long end){
+      for(long long i=begin; i<end; i++)
+        if ( keep_loops || sources[i] != targets[i] ){
+          g.targets[ __atomic_fetch_add(&cursor[ sources[i] ], 1, __ATOMIC_RELAXED) ] = targets[i];
+          if (undirected)
+            g.targets[ __atomic_fetch_add(&cursor[ targets[i] ], 1, __ATOMIC_RELAXED) ] = sources[i];
+        }
+    });
+  GraphMemory::Release(cursor_block);
+  g.Publish();
+  number_edges_ = g.number_edges;
+  undirected_ = undirected;
+
+  //the scatter order depends on the threads, sorting makes the lists canonical
+  Canonicalize(OUT, ( parameter & ( kDeduplicate | kWideOffsets ) ) | ( undirected ? kDeduplicate : 0 ));
+  assign_process.Stop();
+}
+
+void BasicGraph::GenerateRMATGraph(int n_scale, double edge_factor, double a, double b, double c){
+  RMATOptions options;
+  options.scale = n_scale;
+  options.edge_factor = edge_factor * ( ( 1 << n_scale ) - 1 );
+  options.a = a;
+  options.b = b;
+  options.c = c;
+  options.permute = 0;
+  GenerateRMATGraph(options);
+}
+
+void BasicGraph::GenerateRMATGraph(const RMATOptions& options, const int parameter){
+  mProcess rmat_process("RMAT generation of scale " + std::to_string(options.scale), 1, verbose_);
+  rmat_process.Start();
+  std::vector<int> sources, targets;
+  GraphGenerator::RMAT(options, sources, targets);
+  AssignEdges(1 << options.scale, sources.data(), targets.data(), sources.size(), parameter);
+  rmat_process.Stop();
+}
+
+void BasicGraph::GenerateErdosRenyiGraph(int number_vertex, long long number_edges, uint64_t seed, const int parameter){
+  std::vector<int> sources, targets;
+  GraphGenerator::ErdosRenyi(number_vertex, number_edges, seed, sources, targets);
+  AssignEdges(number_vertex, sources.data(), targets.data(), sources.size(), parameter);
+}
+
+void BasicGraph::GenerateBarabasiAlbertGraph(int number_vertex, int edges_per_vertex, uint64_t seed, const int parameter){
+  std::vector<int> sources, targets;
+  GraphGenerator::BarabasiAlbert(number_vertex, edges_per_vertex, seed, sources, targets);
+  AssignEdges(number_vertex, sources.data(), targets.data(), sources.size(), parameter);
+}
+
+void BasicGraph::GenerateWattsStrogatzGraph(int number_vertex, int degree, double rewiring, uint64_t seed, const int parameter){
+  std::vector<int> sources, targets;
+  GraphGenerator::WattsStrogatz(number_vertex, degree, rewiring, seed, sources, targets);
+  AssignEdges(number_vertex, sources.data(), targets.data(), sources.size(), parameter);
+}
+
+void BasicGraph::GenerateGridGraph(int x, int y, int z, bool torus, const int parameter){
+  std::vector<int> sources, targets;
+  GraphGenerator::Grid(x, y, z, torus, sources, targets);
+  AssignEdges(x * y * z, sources.data(), targets.data(), sources.size(), parameter);
+}
+
+void BasicGraph::GenerateStochasticBlockGraph(const std::vector<int>& block_sizes, const std::vector<double>& probabilities,
+                                              uint64_t seed, const int parameter){
+  std::vector<int> sources, targets;
+  GraphGenerator::StochasticBlock(block_sizes, probabilities, seed, sources, targets);
+  int number_vertex = 0;
+  for(auto size: block_sizes)
+    number_vertex += size;
+  AssignEdges(number_vertex, sources.data(), targets.data(), sources.size(), parameter);
 }
 
 void BasicGraph::Dump(GraphType type, int range)const{
@@ -224,7 +577,9 @@ void BasicGraph::Dump(GraphType type, int range)const{
 }
 
 int BasicGraph::GetDegree(int vertex_id, GraphType type)const{
-  const BasicGraphImpl &g = graphs_[static_cast<int>(type)];
+  type = Stored(type);
+  Materialize(type);
+  const BasicGraphImpl &g = graphs_[static_cast<int>(type)].Local();
   if (vertex_id == 0)
     return g.boundaries[0];
   else
@@ -232,21 +587,72 @@ int BasicGraph::GetDegree(int vertex_id, GraphType type)const{
 }
 
 std::vector<int> BasicGraph::GetNeighbors(int vertex_id, GraphType type)const{
-  const BasicGraphImpl &g = graphs_[static_cast<int>(type)];
+  type = Stored(type);
+  Materialize(type);
+  const BasicGraphImpl &g = graphs_[static_cast<int>(type)].Local();
   std::vector<int> ret;
-  int start= vertex_id ? g.boundaries[vertex_id-1] : 0;
-  for(int j = start ; j < g.boundaries[vertex_id]; j++)
+  if (g.compressed.offsets){
+    ret.resize( GetDegree(vertex_id, type) );
+    if (!ret.empty())
+      DecodeNeighbors(vertex_id, &ret[0], type);
+    return ret;
+  }
+  long long start = g.boundaries.Start(vertex_id);
+  for(long long j = start ; j < g.boundaries[vertex_id]; j++)
     ret.push_back(g.targets[j]);
   return ret;
 }
 
 std::pair<const int*, const int*>  BasicGraph::GetNeighborsIterators(int vertex_id, GraphType type)const{
-  const BasicGraphImpl &g = graphs_[static_cast<int>(type)];
+  type = Stored(type);
+  Materialize(type);
+  const BasicGraphImpl &g = graphs_[static_cast<int>(type)].Local();
+  CheckPlain(type);
   std::vector<int> ret;
-  int start= vertex_id ? g.boundaries[vertex_id-1] : 0;
+  long long start = g.boundaries.Start(vertex_id);
   return std::make_pair( g.targets + start, g.targets + g.boundaries[vertex_id] );
 }
 
+bool BasicGraph::HasEdge(int source, int target, GraphType type)const{
+  type = Stored(type);
+  Materialize(type);
+  const BasicGraphImpl &g = graphs_[static_cast<int>(type)].Local();
+  if (g.compressed.offsets){
+    //a sorted list can stop at the first larger neighbor
+    for(NeighborIterator it = GetNeighborIterator(source, type); it.HasNext(); ){
+      int neighbor = it.Next();
+      if (neighbor == target)
+        return 1;
+      if (g.sorted && neighbor > target)
+        return 0;
+    }
+    return 0;
+  }
+  const int *first = g.targets + g.boundaries.Start(source), *last = g.targets + g.boundaries[source];
+  if (g.sorted)
+    return std::binary_search(first, last, target);
+  return std::find(first, last, target) != last;
+}
+
+void BasicGraph::LoadViews(const std::string& base_path, const int parameter){
+  GraphType types[]={OUT, IN, INTERSECTION, UNION};
+  for(int i=0; i<BAD; i++)
+    LoadView(base_path, types[i], parameter);
+}
+
+void BasicGraph::LoadView(const std::string& base_path, const GraphType type, const int parameter){
+  if (undirected_ && type != OUT)
+    return;
+  //look for the text files first, then for the binary ones,
+  //a view found in neither is generated from OUT on first use
+  std::string base_name(base_path + ".imp_" + CONVERT_TO_STRING(type));
+  if ( !(parameter & kMapped) && FilePath::Exist(base_name + ".ind") )
+    LoadImpl(base_path, type, parameter & ~kBinary);
+  else
+    if ( FilePath::Exist(base_name + "_bin.ind") || type == OUT )
+      LoadImpl(base_path, type, parameter | kBinary);
+}
+
 void BasicGraph::LoadImpl(const std::string& base_path, const GraphType type, const int parameter){
   mProcess loadimpl_process("loading impl in "+base_path+" for type "+CONVERT_TO_STRING(type), 1, verbose_);
   loadimpl_process.Start();
@@ -261,63 +667,961 @@ void BasicGraph::LoadImpl(const std::string& base_path, const GraphType type, co
   std::ifstream index_stream(index_name);
   std::ifstream bound_stream(bound_name);
   std::ifstream target_stream(target_name);
-  int* index_array=0;
+  int index_array[2];
 
   FilePath::CheckForOpen(index_name, index_stream);
   FilePath::CheckForOpen(bound_name, bound_stream);
   FilePath::CheckForOpen(target_name, target_stream);
 
+  g.Clear();
   if (parameter & kBinary){
-    //the implementation was stored in binary files
+    //the implementation was stored in binary files, the index tells
+    //the width of the boundaries
     LoadBinaryFile<int>(index_name, index_stream, 2, index_array, verbose_);
     g.number_edges=index_array[1];
-    g.generated=1;
-    LoadBinaryFile<int>(bound_name, bound_stream, number_vertex_, g.boundaries, verbose_);
-    LoadBinaryFile<int>(target_name, target_stream, g.number_edges, g.targets, verbose_);
+    bool wide = index_array[1] == kWideEdgeCount;
+    if (wide)
+      LoadBinaryFile<long long>(index_name, index_stream, 1, &g.number_edges, verbose_);
+    uint32_t flags = 0;
+    if ( !index_stream.read( reinterpret_cast<char*>(&flags), sizeof(flags) ) )
+      flags = 0;
+    g.sorted = flags & kSectionSorted;
+    if (parameter & kMapped){
+      //the arrays point straight into the page cache, nothing is copied
+      if (wide)
+        g.boundaries.Bind(MapBinaryFile<long long>(bound_name, number_vertex_, g.boundaries_block, parameter, verbose_), sizeof(long long));
+      else
+        g.boundaries.Bind(MapBinaryFile<int>(bound_name, number_vertex_, g.boundaries_block, parameter, verbose_), sizeof(int));
+      g.targets=MapBinaryFile<int>(target_name, g.number_edges, g.targets_block, parameter, verbose_);
+    }else{
+      g.AllocateBoundaries(number_vertex_, wide);
+      g.AllocateTargets(g.number_edges);
+      if (wide)
+        LoadBinaryFile<long long>(bound_name, bound_stream, number_vertex_, g.boundaries.Wide(), verbose_);
+      else
+        LoadBinaryFile<int>(bound_name, bound_stream, number_vertex_, g.boundaries.Narrow(), verbose_);
+      LoadBinaryFile<int>(target_name, target_stream, g.number_edges, g.targets, verbose_);
+    }
   }else{
-    //the implementation was stored in text files
-    LoadTextFile<int>(index_name, index_stream, 2, index_array, verbose_);
-    g.generated=1;
-    g.number_edges=index_array[1];
-    LoadTextFile<int>(bound_name, bound_stream, number_vertex_, g.boundaries, verbose_);
-    LoadTextFile<int>(target_name, target_stream, g.number_edges, g.targets, verbose_);    
-  }    
+    //the implementation was stored in text files, the boundaries are
+    //read 64-bit when the edge count asks for it
+    long long text_index[2];
+    LoadTextFile<long long>(index_name, index_stream, 2, text_index, verbose_);
+    g.number_edges=text_index[1];
+    uint32_t flags = 0;
+    if ( !(index_stream >> flags) )
+      flags = 0;
+    g.sorted = flags & kSectionSorted;
+    bool wide = (parameter & kWideOffsets) || EdgeOffsets::NeedsWide(g.number_edges);
+    g.AllocateBoundaries(number_vertex_, wide);
+    g.AllocateTargets(g.number_edges);
+    if (wide)
+      TextParser::ParseFile<long long>(bound_name, number_vertex_, g.boundaries.Wide(), verbose_);
+    else
+      TextParser::ParseFile<int>(bound_name, number_vertex_, g.boundaries.Narrow(), verbose_);
+    TextParser::ParseFile<int>(target_name, g.number_edges, g.targets, verbose_);
+  }
+  g.Publish();
   loadimpl_process.Stop();
 }
 
 void BasicGraph::SaveImpl(const std::string& base_path, const GraphType type, const int parameter)const{
+  Materialize(type);
   const BasicGraphImpl &g=graphs_[ static_cast<int>(type) ];
   std::string base_name(base_path + ".imp_" + CONVERT_TO_STRING(type));
   if (parameter & kBinary)
     base_name += "_bin";
+  mProcess save_process("Save of " + base_name, 1, verbose_);
+  save_process.Start();
 
-  std::string index_name( base_name + ".ind" );
-  FilePath::CheckForExistence(index_name);
-  std::string bound_name( base_name + ".bou" );
-  FilePath::CheckForExistence(bound_name);
-  std::string target_name( base_name + ".tar" );
-  FilePath::CheckForExistence(target_name);
-
-  std::ofstream index_stream(index_name);
-  FilePath::CheckForCreation(index_name, index_stream);
-  std::ofstream bound_stream(bound_name);
-  FilePath::CheckForCreation(bound_name, bound_stream);
-  std::ofstream target_stream(target_name);
-  FilePath::CheckForCreation(target_name, target_stream);
+  //the files hold plain lists, a compressed view is decoded for the save
+  MemoryBlock decoded_block;
+  const int *targets = g.targets;
+  if (g.compressed.offsets){
+    decoded_block = GraphMemory::Allocate( sizeof(int) * g.number_edges );
+    g.DecodeTargets(number_vertex_, static_cast<int*>(decoded_block.address));
+    targets = static_cast<const int*>(decoded_block.address);
+  }
 
-  int *index_array;
-  index_array=new int [2];
-  index_array[0]=number_vertex_; index_array[1]=g.number_edges;
+  bool overwrite = parameter & kOverwrite;
+  AtomicFile index_file(base_name + ".ind", overwrite);
+  AtomicFile bound_file(base_name + ".bou", overwrite);
+  AtomicFile target_file(base_name + ".tar", overwrite);
+  bool wide = g.boundaries.IsWide();
+  uint32_t flags = ( g.compressed.offsets ? g.compressed.sorted : g.sorted ) ? kSectionSorted : 0;
 
   if (parameter & kBinary){
-    SaveBinaryFile<int>(index_name, index_stream, 2, index_array, verbose_);
-    SaveBinaryFile<int>(bound_name, bound_stream, number_vertex_, g.boundaries, verbose_);
-    SaveBinaryFile<int>(target_name, target_stream, g.number_edges, g.targets, verbose_);
+    int index_array[2] = { number_vertex_, wide ? kWideEdgeCount : static_cast<int>(g.number_edges) };
+    ParallelWriter::WriteBinary(index_file, 0, index_array, sizeof(index_array));
+    uint64_t index_length = sizeof(index_array);
+    if (wide){
+      ParallelWriter::WriteBinary(index_file, index_length, &g.number_edges, sizeof(g.number_edges));
+      index_length += sizeof(g.number_edges);
+    }
+    ParallelWriter::WriteBinary(index_file, index_length, &flags, sizeof(flags));
+    ParallelWriter::WriteBinary(bound_file, 0, g.boundaries.Data(), g.boundaries.ElementSize() * number_vertex_);
+    ParallelWriter::WriteBinary(target_file, 0, targets, sizeof(int) * g.number_edges);
+  }else{
+    long long index_array[3] = { number_vertex_, g.number_edges, flags };
+    ParallelWriter::WriteText(index_file, 0, index_array, 3);
+    if (wide)
+      ParallelWriter::WriteText(bound_file, 0, g.boundaries.Wide(), number_vertex_);
+    else
+      ParallelWriter::WriteText(bound_file, 0, g.boundaries.Narrow(), number_vertex_);
+    ParallelWriter::WriteText(target_file, 0, targets, g.number_edges);
+  }
+  GraphMemory::Release(decoded_block);
+  //a reader that finds the index finds the arrays too
+  target_file.Commit();
+  bound_file.Commit();
+  index_file.Commit();
+  save_process.Stop();
+}
+
+void BasicGraph::LoadMapping(const std::string& base_path, const int parameter){
+  //the text file first, then the binary one, as for the views
+  std::string text_name(base_path + ".imp_map.ids");
+  std::string binary_name(base_path + ".imp_map_bin.ids");
+  MemoryBlock block;
+  if ( !(parameter & kMapped) && FilePath::Exist(text_name) ){
+    block = GraphMemory::Allocate( sizeof(long long) * number_vertex_ );
+    TextParser::ParseFile<long long>(text_name, number_vertex_, static_cast<long long*>(block.address), verbose_);
+  }else{
+    if (!FilePath::Exist(binary_name))
+      return;
+    if (parameter & kMapped){
+      MapBinaryFile<long long>(binary_name, number_vertex_, block, parameter, verbose_);
+    }else{
+      std::ifstream stream(binary_name);
+      FilePath::CheckForOpen(binary_name, stream);
+      block = GraphMemory::Allocate( sizeof(long long) * number_vertex_ );
+      LoadBinaryFile<long long>(binary_name, stream, number_vertex_, static_cast<long long*>(block.address), verbose_);
+    }
+  }
+  BindMapping(static_cast<long long*>(block.address), block);
+  IndexMapping();
+}
+
+void BasicGraph::SaveMapping(const std::string& base_path, const int parameter)const{
+  std::string name( base_path + ( (parameter & kBinary) ? ".imp_map_bin.ids" : ".imp_map.ids" ) );
+  mProcess save_process("Save of " + name, 1, verbose_);
+  save_process.Start();
+  AtomicFile file(name, parameter & kOverwrite);
+  if (parameter & kBinary)
+    ParallelWriter::WriteBinary(file, 0, to_raw_, sizeof(long long) * number_vertex_);
+  else
+    ParallelWriter::WriteText(file, 0, to_raw_, number_vertex_);
+  file.Commit();
+  save_process.Stop();
+}
+
+void BasicGraph::BindMapping(long long *to_raw, const MemoryBlock& block){
+  GraphMemory::Release(to_raw_block_);
+  to_raw_block_ = block;
+  to_raw_ = to_raw;
+  BindIndex(0, 0, MemoryBlock());
+}
+
+void BasicGraph::BindIndex(const IdSlot *slots, uint64_t capacity, const MemoryBlock& block){
+  GraphMemory::Release(from_raw_block_);
+  from_raw_block_ = block;
+  from_raw_.Bind(slots, capacity);
+}
+
+void BasicGraph::IndexMapping(){
+  if (!to_raw_ || from_raw_.IsBound())
+    return;
+  uint64_t capacity = IdIndex::Capacity(number_vertex_);
+  MemoryBlock block = GraphMemory::Allocate( sizeof(IdSlot) * capacity );
+  IdSlot *slots = static_cast<IdSlot*>(block.address);
+  if (!IdIndex::Build(to_raw_, number_vertex_, slots)){
+    GraphMemory::Release(block);
+    BindMapping(0, MemoryBlock());
+    throw std::runtime_error("A raw id is shared by several vertices");
+  }
+  BindIndex(slots, capacity, block);
+}
+
+std::vector<int> BasicGraph::FromRawIds(const std::vector<long long> &raw_ids)const{
+  std::vector<int> ids(raw_ids.size());
+  if (to_raw_){
+    from_raw_.FindAll(raw_ids.data(), raw_ids.size(), ids.data());
+    return ids;
+  }
+  mParallel::For(0, raw_ids.size(), [&](int thread_id, long long begin, long long end){
+      for(long long i=begin; i<end; i++)
+        ids[i] = FromRawId(raw_ids[i]);
+    }, IdIndex::BatchThreads( raw_ids.size() ));
+  return ids;
+}
+
+std::vector<long long> BasicGraph::ToRawIds(const std::vector<int> &ids)const{
+  std::vector<long long> raw_ids(ids.size());
+  mParallel::For(0, ids.size(), [&](int thread_id, long long begin, long long end){
+      for(long long i=begin; i<end; i++){
+        if ( to_raw_ && i + IdIndex::kPrefetchDistance < end )
+          __builtin_prefetch( to_raw_ + ids[ i + IdIndex::kPrefetchDistance ] );
+        raw_ids[i] = ToRawId(ids[i]);
+      }
+    }, IdIndex::BatchThreads( ids.size() ));
+  return raw_ids;
+}
+
+void BasicGraph::LoadContainer(const std::string& path, const int parameter){
+  mProcess container_process("Loading of container " + path, 1, verbose_);
+  container_process.Start();
+  if (parameter & kMapped){
+    image_block_ = GraphMemory::MapFile(path, parameter & kPopulate, parameter & kWillNeed);
+    BindImage(static_cast<const char*>(image_block_.address), image_block_.length, path, parameter);
+  }else{
+    std::vector<GraphSection> sections = LoadSectionTable(path);
+    LoadContainerView(path, sections, BAD);
+    IndexMapping();
+    GraphType types[]={OUT, IN, INTERSECTION, UNION};
+    for(int i=0; i<BAD; i++)
+      LoadContainerView(path, sections, types[i]);
+  }
+  container_process.Stop();
+}
+
+std::vector<GraphSection> BasicGraph::LoadSectionTable(const std::string& path){
+  std::ifstream stream(path, std::ios::binary);
+  FilePath::CheckForOpen(path, stream);
+  stream.seekg(0, std::ios::end);
+  uint64_t file_length = stream.tellg();
+  stream.seekg(0, std::ios::beg);
+
+  GraphFileHeader header;
+  stream.read( reinterpret_cast<char*>(&header), sizeof(header) );
+  GraphFormat::CheckHeader(header, file_length, path);
+  std::vector<GraphSection> sections(header.number_sections);
+  stream.read( reinterpret_cast<char*>(sections.data()), sizeof(GraphSection) * header.number_sections );
+  for(uint32_t i=0; i<header.number_sections; i++){
+    GraphFormat::CheckSection(sections[i], file_length, path);
+    if (!KnownSection(sections[i], header.number_vertex))
+      throw std::runtime_error("Unknown section in " + path);
+  }
+  CheckSectionCounts(header, sections.data(), path);
+  number_vertex_ = header.number_vertex;
+  number_edges_ = header.number_edges;
+  undirected_ = header.flags & kGraphUndirected;
+  return sections;
+}
+
+void BasicGraph::LoadContainerView(const std::string& path, const std::vector<GraphSection>& sections, const GraphType type){
+  //every view reads through its own stream so that they can be loaded side by side,
+  //BAD reads the sections that belong to no view
+  std::ifstream stream(path, std::ios::binary);
+  FilePath::CheckForOpen(path, stream);
+  bool found = 0;
+  for(size_t i=0; i<sections.size(); i++){
+    const GraphSection& section=sections[i];
+    if (section.view != static_cast<uint32_t>(type))
+      continue;
+    MemoryBlock block = GraphMemory::Allocate(section.length);
+    char *array = static_cast<char*>(block.address);
+    stream.seekg(section.offset, std::ios::beg);
+    LoadBinaryFile<char>(path, stream, section.length, array, verbose_);
+    BindSection(section, array, block);
+    //the data is copied anyway, checking it costs little on top of that
+    GraphFormat::CheckChecksum(section, array, path);
+    found = 1;
+  }
+  if (found && type != BAD){
+    CheckBoundView(sections.data(), sections.size(), type, path);
+    graphs_[ static_cast<int>(type) ].Publish();
+  }
+}
+
+void BasicGraph::AttachImage(const char *image, size_t length, const int parameter){
+  Clear();
+  BindImage(image, length, "memory image", parameter);
+}
+
+void BasicGraph::BindImage(const char *image, size_t length, const std::string& name, const int parameter){
+  GraphFileHeader header;
+  if (length >= sizeof(header))
+    memcpy(&header, image, sizeof(header));
+  GraphFormat::CheckHeader(header, length, name);
+  const GraphSection *sections = reinterpret_cast<const GraphSection*>( image + sizeof(header) );
+  for(uint32_t i=0; i<header.number_sections; i++){
+    GraphFormat::CheckSection(sections[i], length, name);
+    if (!KnownSection(sections[i], header.number_vertex))
+      throw std::runtime_error("Unknown section in " + name);
+  }
+  CheckSectionCounts(header, sections, name);
+  number_vertex_ = header.number_vertex;
+  number_edges_ = header.number_edges;
+  undirected_ = header.flags & kGraphUndirected;
+  for(uint32_t i=0; i<header.number_sections; i++){
+    const GraphSection& section=sections[i];
+    if (parameter & kVerify)
+      GraphFormat::CheckChecksum(section, image + section.offset, name);
+    //the image is read-only, the views only borrow it
+    BindSection(section, const_cast<char*>( image + section.offset ), MemoryBlock());
+  }
+  for(int i=0; i<BAD; i++)
+    if (graphs_[i].boundaries.Data())
+      CheckBoundView(sections, header.number_sections, static_cast<GraphType>(i), name);
+  for(uint32_t i=0; i<header.number_sections; i++)
+    if (sections[i].view < BAD)
+      graphs_[ sections[i].view ].Publish();
+  IndexMapping();
+}
+
+void BasicGraph::CheckBoundView(const GraphSection *sections, size_t number_sections, GraphType type, const std::string& path)const{
+  //the last boundary is the edge count of the view, the targets or the
+  //encoded lists must hold that many edges
+  const BasicGraphImpl &g=graphs_[ static_cast<int>(type) ];
+  if (g.number_edges < 0)
+    throw std::runtime_error("Corrupted section in " + path);
+  for(size_t i=0; i<number_sections; i++){
+    const GraphSection& section=sections[i];
+    if (section.view != static_cast<uint32_t>(type))
+      continue;
+    if ( section.kind == kTargetSection && section.count != static_cast<uint64_t>(g.number_edges) )
+      throw std::runtime_error("Corrupted section in " + path);
+    if (section.kind == kOffsetSection){
+      const CompressedTargets &c=g.compressed;
+      uint64_t end = c.offsets[number_vertex_];
+      if ( c.offsets[0] != 0 || end > c.data_length || c.data_length - end < static_cast<uint64_t>(StreamVByte::kPadding) )
+        throw std::runtime_error("Corrupted section in " + path);
+    }
+  }
+}
+
+void BasicGraph::BindSection(const GraphSection& section, char *address, const MemoryBlock& block){
+  if (section.kind == kMappingSection){
+    BindMapping(reinterpret_cast<long long*>(address), block);
+    return;
+  }
+  if (section.kind == kIdIndexSection){
+    BindIndex(reinterpret_cast<const IdSlot*>(address), section.count, block);
+    return;
+  }
+  BasicGraphImpl &g=graphs_[section.view];
+  switch (section.kind){
+  case kBoundarySection:
+    GraphMemory::Release(g.boundaries_block);
+    g.boundaries_block = block;
+    g.boundaries.Bind(address, section.element_size);
+    g.number_edges = section.count ? g.boundaries[section.count-1] : 0;
+    g.sorted = section.flags & kSectionSorted;
+    break;
+  case kTargetSection:
+    GraphMemory::Release(g.targets_block);
+    g.targets_block = block;
+    g.targets = reinterpret_cast<int*>(address);
+    break;
+  case kOffsetSection:
+    GraphMemory::Release(g.compressed.offsets_block);
+    g.compressed.offsets_block = block;
+    g.compressed.offsets = reinterpret_cast<uint64_t*>(address);
+    break;
+  case kCompressedSection:
+    GraphMemory::Release(g.compressed.data_block);
+    g.compressed.data_block = block;
+    g.compressed.data = reinterpret_cast<unsigned char*>(address);
+    g.compressed.data_length = section.length;
+    g.compressed.sorted = section.flags & kSectionSorted;
+    break;
+  default:
+    break;
+  }
+}
+
+void BasicGraph::ContainerLayout(const int parameter, GraphFileHeader& header, GraphSection *sections)const{
+  const int view_parameters[]={kOut, kIn, kIntersect, kUnion};
+  GraphType types[]={OUT, IN, INTERSECTION, UNION};
+  GraphFormat::InitHeader(header);
+  header.number_vertex = number_vertex_;
+  header.number_edges = number_edges_;
+  if (undirected_)
+    header.flags |= kGraphUndirected;
+  uint64_t offset = GraphFormat::Align( sizeof(GraphFileHeader) + kMaxSections * sizeof(GraphSection) );
+  auto add_section = [&](GraphType type, SectionKind kind, uint64_t count, uint32_t flags){
+    GraphSection &section=sections[ header.number_sections++ ];
+    memset(&section, 0, sizeof(section));
+    section.view = type;
+    section.kind = kind;
+    section.flags = flags;
+    section.element_size = kind == kBoundarySection ? graphs_[type].boundaries.ElementSize() : GraphFormat::ElementSize(kind);
+    section.count = count;
+    section.offset = offset;
+    section.length = section.count * section.element_size;
+    offset = GraphFormat::Align( offset + section.length );
+  };
+  for(int i=0; i<BAD; i++){
+    const BasicGraphImpl &g=graphs_[ static_cast<int>(types[i]) ];
+    if ( !(parameter & view_parameters[i]) || !g.generated )
+      continue;
+    if (g.compressed.offsets){
+      uint32_t flags = g.compressed.sorted ? kSectionSorted : 0;
+      add_section(types[i], kBoundarySection, number_vertex_, flags);
+      add_section(types[i], kOffsetSection, number_vertex_ + 1, flags);
+      add_section(types[i], kCompressedSection, g.compressed.data_length, flags);
+    }else{
+      uint32_t flags = g.sorted || SortedNeighbors(g.boundaries, g.targets, number_vertex_) ? kSectionSorted : 0;
+      add_section(types[i], kBoundarySection, number_vertex_, flags);
+      add_section(types[i], kTargetSection, g.number_edges, flags);
+    }
+  }
+  if ( (parameter & kMapping) && to_raw_ ){
+    add_section(BAD, kMappingSection, number_vertex_, 0);
+    add_section(BAD, kIdIndexSection, IdIndex::Capacity(number_vertex_), 0);
+  }
+}
+
+const char* BasicGraph::SectionData(const GraphSection& section)const{
+  if (section.kind == kMappingSection)
+    return reinterpret_cast<const char*>(to_raw_);
+  if (section.kind == kIdIndexSection)
+    return reinterpret_cast<const char*>( from_raw_.Slots() );
+  const BasicGraphImpl &g=graphs_[section.view];
+  switch (section.kind){
+  case kBoundarySection:
+    return static_cast<const char*>(g.boundaries.Data());
+  case kTargetSection:
+    return reinterpret_cast<const char*>(g.targets);
+  case kOffsetSection:
+    return reinterpret_cast<const char*>(g.compressed.offsets);
+  case kCompressedSection:
+    return reinterpret_cast<const char*>(g.compressed.data);
+  default:
+    return 0;
+  }
+}
+
+void BasicGraph::SaveContainer(const std::string& path, const int parameter)const{
+  mProcess save_process("Save of container " + path, 1, verbose_);
+  save_process.Start();
+  AtomicFile file(path, parameter & kOverwrite);
+  GraphFileHeader header;
+  GraphSection sections[kMaxSections];
+  ContainerLayout(parameter, header, sections);
+
+  for(uint32_t i=0; i<header.number_sections; i++)
+    sections[i].checksum = GraphFormat::Checksum( SectionData(sections[i]), sections[i].length );
+
+  //the gaps between the sections are holes and read back as zeros
+  file.Write(0, &header, sizeof(header));
+  file.Write(sizeof(header), sections, sizeof(GraphSection) * header.number_sections);
+  for(uint32_t i=0; i<header.number_sections; i++)
+    ParallelWriter::WriteBinary(file, sections[i].offset, SectionData(sections[i]), sections[i].length);
+  file.Commit();
+  save_process.Stop();
+}
+
+size_t BasicGraph::ImageSize(const int saved_parameter)const{
+  const int parameter = SavedViews(saved_parameter);
+  MaterializeViews(parameter);
+  GraphFileHeader header;
+  GraphSection sections[kMaxSections];
+  ContainerLayout(parameter, header, sections);
+  uint64_t size = GraphFormat::Align( sizeof(GraphFileHeader) + kMaxSections * sizeof(GraphSection) );
+  for(uint32_t i=0; i<header.number_sections; i++)
+    size = std::max( size, GraphFormat::Align( sections[i].offset + sections[i].length ) );
+  return size;
+}
+
+void BasicGraph::WriteImage(char *image, const int saved_parameter)const{
+  const int parameter = SavedViews(saved_parameter);
+  MaterializeViews(parameter);
+  mProcess write_process("Writing of graph image", 1, verbose_);
+  write_process.Start();
+  GraphFileHeader header;
+  GraphSection sections[kMaxSections];
+  ContainerLayout(parameter, header, sections);
+  //the sections are copied in blocks by all threads, the checksums are taken
+  //from the copies and the padding is cleared as a file hole would be
+  uint64_t table_end = sizeof(header) + sizeof(GraphSection) * header.number_sections;
+  uint64_t end = GraphFormat::Align( sizeof(GraphFileHeader) + kMaxSections * sizeof(GraphSection) );
+  memset(image + table_end, 0, end - table_end);
+  for(uint32_t i=0; i<header.number_sections; i++){
+    const GraphSection& section=sections[i];
+    CopyInParallel(image + section.offset, SectionData(section), section.length);
+    sections[i].checksum = GraphFormat::Checksum( image + section.offset, section.length );
+    uint64_t section_end = section.offset + section.length;
+    memset(image + section_end, 0, GraphFormat::Align(section_end) - section_end);
+  }
+  memcpy(image, &header, sizeof(header));
+  memcpy(image + sizeof(header), sections, sizeof(GraphSection) * header.number_sections);
+  write_process.Stop();
+}
+
+void BasicGraph::Canonicalize(GraphType type, const int parameter){
+  type = Stored(type);
+  Materialize(type);
+  CheckPlain(type);
+  BasicGraphImpl &g=graphs_[ static_cast<int>(type) ];
+  ResetPlacement();
+  mProcess canonicalize_process("Canonicalization of graph " + CONVERT_TO_STRING(type), 1, verbose_);
+  canonicalize_process.Start();
+
+  //lists on the heap are cleaned where they are, mapped or borrowed ones are
+  //copied first. counts keeps the length of every cleaned list
+  MemoryBlock copy_block;
+  int *targets = g.targets;
+  if (!GraphMemory::IsWritable(g.targets_block)){
+    copy_block = GraphMemory::Allocate( sizeof(int) * g.number_edges );
+    targets = static_cast<int*>(copy_block.address);
+  }
+  MemoryBlock counts_block = GraphMemory::Allocate( sizeof(long long) * number_vertex_ );
+  long long *counts = static_cast<long long*>(counts_block.address);
+  ForEachVertexBlock(g.boundaries, number_vertex_, [&](int thread_id, int begin, int end){
+      for(int i=begin; i<end; i++){
+        long long start = g.boundaries.Start(i);
+        int *first = targets + start, *last = targets + g.boundaries[i];
+        if (targets != g.targets)
+          memcpy(first, g.targets + start, sizeof(int) * ( last - first ));
+        if (!g.sorted)
+          std::sort(first, last);
+        if (parameter & kDeduplicate)
+          last = std::unique(first, last);
+        if (parameter & kNoSelfLoops){
+          std::pair<int*, int*> loops = std::equal_range(first, last, i);
+          last = std::copy(loops.second, last, loops.first);
+        }
+        counts[i] = last - first;
+      }
+    });
+  mParallel::PrefixSum(counts, number_vertex_);
+  long long number_edges = number_vertex_ ? counts[number_vertex_-1] : 0;
+  bool wide = (parameter & kWideOffsets) || EdgeOffsets::NeedsWide(number_edges);
+  bool dropped = number_edges != g.number_edges;
+
+  if (!dropped && wide == g.boundaries.IsWide()){
+    //nothing was dropped, the boundaries stand as they are
+    if (copy_block.address){
+      GraphMemory::Release(g.targets_block);
+      g.targets_block = copy_block;
+      g.targets = targets;
+    }
+  }else{
+    //compact the cleaned prefixes of the lists into fresh arrays, also when
+    //only the width of the offsets changes
+    MemoryBlock old_targets_block = copy_block.address ? copy_block : g.targets_block;
+    if (!copy_block.address)
+      g.targets_block = MemoryBlock();
+    MemoryBlock old_boundaries_block = g.boundaries_block;
+    EdgeOffsets old_boundaries = g.boundaries;
+    g.boundaries_block = MemoryBlock();
+    g.number_edges = number_edges;
+    g.AllocateBoundaries(number_vertex_, wide);
+    mParallel::For(0, number_vertex_, [&](int thread_id, long long begin, long long end){
+        for(long long i=begin; i<end; i++)
+          g.boundaries.Set(i, counts[i]);
+      });
+    g.AllocateTargets(number_edges);
+    ForEachVertexBlock(g.boundaries, number_vertex_, [&](int thread_id, int begin, int end){
+        for(int i=begin; i<end; i++){
+          long long start = g.boundaries.Start(i);
+          memcpy(g.targets + start, targets + old_boundaries.Start(i), sizeof(int) * ( g.boundaries[i] - start ));
+        }
+      });
+    GraphMemory::Release(old_targets_block);
+    GraphMemory::Release(old_boundaries_block);
+    if (type == OUT && dropped){
+      number_edges_ = number_edges;
+      GraphType derived_types[]={IN, INTERSECTION, UNION};
+      for(int i=0; i<BAD-1; i++){
+        WaitForView(derived_types[i]);
+        graphs_[ static_cast<int>(derived_types[i]) ].Clear();
+      }
+    }
+  }
+  GraphMemory::Release(counts_block);
+  g.sorted=1;
+  canonicalize_process.Stop();
+}
+
+void BasicGraph::Symmetrize(){
+  if (undirected_)
+    return;
+  MaterializeViews(kUnion);
+  WaitForLoads();
+  mProcess symmetrize_process("Symmetrization of graph", 1, verbose_);
+  symmetrize_process.Start();
+  ResetPlacement();
+  //UNION holds every edge in both directions once, it becomes OUT as it is
+  std::swap(graphs_[ static_cast<int>(OUT) ], graphs_[ static_cast<int>(UNION) ]);
+  for(int i=0; i<BAD; i++)
+    if (i != static_cast<int>(OUT))
+      graphs_[i].Clear();
+  number_edges_ = graphs_[ static_cast<int>(OUT) ].number_edges;
+  undirected_ = 1;
+  symmetrize_process.Stop();
+}
+
+void BasicGraph::Reorder(VertexOrder order){
+  Materialize(OUT);
+  mProcess order_process("Vertex ordering", 1, verbose_);
+  order_process.Start();
+  //the orders walk plain lists, compressed views are decoded for them
+  MemoryBlock decoded_blocks[2];
+  auto plain_targets = [&](const BasicGraphImpl& g, MemoryBlock& block)->const int*{
+    if (!g.compressed.offsets)
+      return g.targets;
+    block = GraphMemory::Allocate( sizeof(int) * g.number_edges );
+    g.DecodeTargets(number_vertex_, static_cast<int*>(block.address));
+    return static_cast<const int*>(block.address);
+  };
+  const BasicGraphImpl &out=graphs_[ static_cast<int>(OUT) ];
+  Adjacency out_lists(out.boundaries, plain_targets(out, decoded_blocks[0]));
+  std::vector<int> new_order;
+  if (order == kDegreeOrder){
+    new_order = GraphOrder::Degree(number_vertex_, out_lists);
   }else{
-    SaveTextFile<int>(index_name, index_stream, 2, index_array, verbose_);
-    SaveTextFile<int>(bound_name, bound_stream, number_vertex_, g.boundaries, verbose_);    
-    SaveTextFile<int>(target_name, target_stream, g.number_edges, g.targets, verbose_);    
+    //both directions are followed, IN is OUT itself in an undirected graph
+    GraphType in_type = Stored(IN);
+    Materialize(in_type);
+    const BasicGraphImpl &in=graphs_[ static_cast<int>(in_type) ];
+    Adjacency in_lists(in.boundaries, in_type == OUT ? out_lists.targets : plain_targets(in, decoded_blocks[1]));
+    if (order == kRCMOrder)
+      new_order = GraphOrder::ReverseCuthillMcKee(number_vertex_, out_lists, in_lists);
+    else
+      new_order = GraphOrder::Gorder(number_vertex_, out_lists, in_lists);
+  }
+  GraphMemory::Release(decoded_blocks[0]);
+  GraphMemory::Release(decoded_blocks[1]);
+  order_process.Stop();
+  Reorder(new_order);
+}
+
+void BasicGraph::Reorder(const std::vector<int>& order){
+  //every resident view must be complete before one is touched
+  GraphType types[]={OUT, IN, INTERSECTION, UNION};
+  for(int i=0; i<BAD; i++)
+    WaitForView(types[i]);
+  MemoryBlock new_ids_block = GraphMemory::Allocate( sizeof(int) * number_vertex_ );
+  int *new_ids = static_cast<int*>(new_ids_block.address);
+  if ( static_cast<long long>( order.size() ) != number_vertex_ || !InvertPermutation(order.data(), number_vertex_, new_ids) ){
+    GraphMemory::Release(new_ids_block);
+    throw std::runtime_error("A vertex order must list every vertex once");
+  }
+  mProcess relabel_process("Relabeling of graph", 1, verbose_);
+  relabel_process.Start();
+  ResetPlacement();
+  //compressed views are relabeled plain and encoded again
+  for(int i=0; i<BAD; i++)
+    if (graphs_[i].IsReady()){
+      bool compressed = graphs_[i].compressed.offsets != 0;
+      Relabel(types[i], order.data(), new_ids);
+      if (compressed)
+        Compress(types[i]);
+    }
+  GraphMemory::Release(new_ids_block);
+
+  //the raw id of a new vertex is that of the old one it was
+  MemoryBlock to_raw_block = GraphMemory::Allocate( sizeof(long long) * number_vertex_ );
+  long long *to_raw = static_cast<long long*>(to_raw_block.address);
+  mParallel::For(0, number_vertex_, [&](int thread_id, long long begin, long long end){
+      for(long long i=begin; i<end; i++)
+        to_raw[i] = ToRawId(order[i]);
+    });
+  BindMapping(to_raw, to_raw_block);
+  IndexMapping();
+  relabel_process.Stop();
+}
+
+void BasicGraph::Relabel(GraphType type, const int *order, const int *new_ids){
+  BasicGraphImpl &g=graphs_[ static_cast<int>(type) ];
+  BasicGraphImpl relabeled;
+  MemoryBlock counts_block = GraphMemory::Allocate( sizeof(long long) * number_vertex_ );
+  long long *counts = static_cast<long long*>(counts_block.address);
+  mParallel::For(0, number_vertex_, [&](int thread_id, long long begin, long long end){
+      for(long long i=begin; i<end; i++)
+        counts[i] = g.boundaries[ order[i] ] - g.boundaries.Start( order[i] );
+    });
+  mParallel::PrefixSum(counts, number_vertex_);
+  relabeled.number_edges = g.number_edges;
+  relabeled.AllocateBoundaries(number_vertex_, g.boundaries.IsWide());
+  mParallel::For(0, number_vertex_, [&](int thread_id, long long begin, long long end){
+      for(long long i=begin; i<end; i++)
+        relabeled.boundaries.Set(i, counts[i]);
+    });
+  GraphMemory::Release(counts_block);
+
+  //every list moves to its new vertex, renamed and sorted again
+  relabeled.AllocateTargets(relabeled.number_edges);
+  ForEachVertexBlock(relabeled.boundaries, number_vertex_, [&](int thread_id, int begin, int end){
+      std::vector<int> buffer;
+      for(int i=begin; i<end; i++){
+        const int *list = g.List(order[i], buffer);
+        int *first = relabeled.targets + relabeled.boundaries.Start(i), *last = relabeled.targets + relabeled.boundaries[i];
+        for(int *p = first; p != last; p++)
+          *p = new_ids[ *list++ ];
+        std::sort(first, last);
+      }
+    });
+  relabeled.sorted=1;
+  g.Clear();
+  g = relabeled;
+  g.Publish();
+}
+
+void BasicGraph::Compress(GraphType type){
+  type = Stored(type);
+  Materialize(type);
+  BasicGraphImpl &g=graphs_[ static_cast<int>(type) ];
+  if (!g.generated || g.compressed.offsets)
+    return;
+  ResetPlacement();
+  mProcess compress_process("Compression of graph " + CONVERT_TO_STRING(type), 1, verbose_);
+  compress_process.Start();
+  CompressedTargets &c=g.compressed;
+  g.sorted = g.sorted || SortedNeighbors(g.boundaries, g.targets, number_vertex_);
+  c.sorted = g.sorted;
+  c.offsets_block = GraphMemory::Allocate( sizeof(uint64_t) * ( number_vertex_ + 1 ) );
+  c.offsets = static_cast<uint64_t*>(c.offsets_block.address);
+
+  //size every list, place them one after the other, then encode them in parallel
+  ForEachVertexBlock(g.boundaries, number_vertex_, [&](int thread_id, int begin, int end){
+      for(int i=begin; i<end; i++){
+        long long start = g.boundaries.Start(i);
+        c.offsets[i+1] = StreamVByte::EncodedSize(g.targets + start, g.boundaries[i] - start, c.sorted);
+      }
+    });
+  mParallel::PrefixSum(c.offsets + 1, number_vertex_);
+  c.data_length = c.offsets[number_vertex_] + StreamVByte::kPadding;
+  c.data_block = GraphMemory::Allocate(c.data_length);
+  c.data = static_cast<unsigned char*>(c.data_block.address);
+  ForEachVertexBlock(g.boundaries, number_vertex_, [&](int thread_id, int begin, int end){
+      for(int i=begin; i<end; i++){
+        long long start = g.boundaries.Start(i);
+        StreamVByte::Encode(g.targets + start, g.boundaries[i] - start, c.sorted, c.data + c.offsets[i]);
+      }
+    });
+
+  GraphMemory::Release(g.targets_block);
+  g.targets = 0;
+  compress_process.Stop();
+}
+
+void BasicGraph::Decompress(GraphType type){
+  type = Stored(type);
+  WaitForView(type);
+  BasicGraphImpl &g=graphs_[ static_cast<int>(type) ];
+  if (!g.compressed.offsets)
+    return;
+  mProcess decompress_process("Decompression of graph " + CONVERT_TO_STRING(type), 1, verbose_);
+  decompress_process.Start();
+  g.AllocateTargets(g.number_edges);
+  g.DecodeTargets(number_vertex_, g.targets);
+  GraphMemory::Release(g.compressed.offsets_block);
+  GraphMemory::Release(g.compressed.data_block);
+  g.compressed = CompressedTargets();
+  decompress_process.Stop();
+}
+
+HugePages BasicGraph::GetHugePages(GraphType type)const{
+  type = Stored(type);
+  Materialize(type);
+  const BasicGraphImpl &g = graphs_[static_cast<int>(type)];
+  const MemoryBlock &block = g.compressed.offsets ? g.compressed.data_block : g.targets_block;
+  return block.kind == kNoMemory ? image_block_.pages : block.pages;
+}
+
+bool BasicGraph::PlaceOnNodes(NumaPlacement placement, int nodes){
+  WaitForLoads();
+  if (nodes <= 0)
+    nodes = GraphMemory::NumaNodes();
+  nodes = std::min(nodes, GraphMemory::kMaxNumaNodes);
+  mProcess place_process("NUMA placement of graph on " + std::to_string(nodes) + " nodes", 1, verbose_);
+  place_process.Start();
+  //the ranges hold about the same number of OUT edges, the other views keep
+  //every vertex on the node it has in OUT
+  const BasicGraphImpl &out = graphs_[ static_cast<int>(OUT) ];
+  long long out_edges = out.IsReady() && number_vertex_ ? out.boundaries[number_vertex_-1] : 0;
+  numa_ranges_[0] = 0;
+  for(int k=1; k<nodes; k++)
+    numa_ranges_[k] = out_edges ? out.boundaries.UpperBound(number_vertex_, out_edges * k / nodes) : number_vertex_ * static_cast<long long>(k) / nodes;
+  numa_ranges_[nodes] = number_vertex_;
+  bool placed = 1;
+  for(int i=0; i<BAD; i++){
+    BasicGraphImpl &g = graphs_[i];
+    g.DropReplicas();
+    if (g.IsReady() && placement != kNumaFirstTouch && ( !g.compressed.offsets || placement == kNumaReplicate ))
+      placed = PlaceView(g, placement, nodes) && placed;
+  }
+  numa_placement_ = placement;
+  numa_nodes_ = nodes;
+  place_process.Stop();
+  return placed;
+}
+
+bool BasicGraph::PlaceView(BasicGraphImpl& g, NumaPlacement placement, int nodes){
+  size_t element_size = g.boundaries.ElementSize();
+  bool placed = 1;
+  if (placement == kNumaReplicate){
+    //every copy is bound to its node before it is written, its pages are
+    //allocated there as the threads fill them
+    g.replicas = new BasicGraphImpl[nodes];
+    g.number_replicas = nodes;
+    for(int k=0; k<nodes; k++){
+      BasicGraphImpl &r = g.replicas[k];
+      r.generated = 1;
+      r.sorted = g.sorted;
+      r.number_edges = g.number_edges;
+      r.AllocateBoundaries(number_vertex_, g.boundaries.IsWide());
+      placed = GraphMemory::BindToNode(r.boundaries.Data(), element_size * number_vertex_, k) && placed;
+      CopyInParallel(const_cast<void*>( r.boundaries.Data() ), g.boundaries.Data(), element_size * number_vertex_);
+      if (g.compressed.offsets){
+        //a compressed view is copied encoded, offsets and data alike
+        size_t offsets_length = sizeof(uint64_t) * ( number_vertex_ + 1 );
+        r.compressed.sorted = g.compressed.sorted;
+        r.compressed.data_length = g.compressed.data_length;
+        r.compressed.offsets_block = GraphMemory::Allocate(offsets_length);
+        r.compressed.data_block = GraphMemory::Allocate(g.compressed.data_length);
+        r.compressed.offsets = static_cast<uint64_t*>(r.compressed.offsets_block.address);
+        r.compressed.data = static_cast<unsigned char*>(r.compressed.data_block.address);
+        placed = GraphMemory::BindToNode(r.compressed.offsets, offsets_length, k) && placed;
+        placed = GraphMemory::BindToNode(r.compressed.data, g.compressed.data_length, k) && placed;
+        CopyInParallel(r.compressed.offsets, g.compressed.offsets, offsets_length);
+        CopyInParallel(r.compressed.data, g.compressed.data, g.compressed.data_length);
+        continue;
+      }
+      r.AllocateTargets(g.number_edges);
+      placed = GraphMemory::BindToNode(r.targets, sizeof(int) * g.number_edges, k) && placed;
+      CopyInParallel(r.targets, g.targets, sizeof(int) * g.number_edges);
+    }
+    return placed;
+  }
+
+  //mapped and borrowed arrays become ours first
+  if (!GraphMemory::IsWritable(g.boundaries_block)){
+    MemoryBlock block = GraphMemory::Allocate( element_size * number_vertex_ );
+    CopyInParallel(block.address, g.boundaries.Data(), element_size * number_vertex_);
+    GraphMemory::Release(g.boundaries_block);
+    g.boundaries_block = block;
+    g.boundaries.Bind(block.address, element_size);
+  }
+  if (!GraphMemory::IsWritable(g.targets_block)){
+    MemoryBlock block = GraphMemory::Allocate( sizeof(int) * g.number_edges );
+    CopyInParallel(block.address, g.targets, sizeof(int) * g.number_edges);
+    GraphMemory::Release(g.targets_block);
+    g.targets_block = block;
+    g.targets = static_cast<int*>(block.address);
+  }
+  const char *boundaries = static_cast<const char*>( g.boundaries.Data() );
+  if (placement == kNumaInterleave){
+    placed = GraphMemory::Interleave(boundaries, element_size * number_vertex_, nodes) && placed;
+    return GraphMemory::Interleave(g.targets, sizeof(int) * g.number_edges, nodes) && placed;
   }
+  //the pages straddling two ranges stay where they are
+  for(int k=0; k<nodes; k++){
+    int begin = numa_ranges_[k], end = numa_ranges_[k+1];
+    if (begin == end)
+      continue;
+    long long first = g.boundaries.Start(begin), last = g.boundaries[end-1];
+    placed = GraphMemory::BindToNode(boundaries + element_size * begin, element_size * ( end - begin ), k) && placed;
+    placed = GraphMemory::BindToNode(g.targets + first, sizeof(int) * ( last - first ), k) && placed;
+  }
+  return placed;
+}
+
+void BasicGraph::ResetPlacement(){
+  for(int i=0; i<BAD; i++)
+    graphs_[i].DropReplicas();
+  numa_placement_ = kNumaFirstTouch;
+  numa_nodes_ = 1;
+  numa_ranges_[0] = 0;
+  numa_ranges_[1] = number_vertex_;
+}
+
+int BasicGraph::GetVertexNode(int vertex_id)const{
+  if (numa_placement_ != kNumaPartition)
+    return 0;
+  return std::upper_bound(numa_ranges_, numa_ranges_ + numa_nodes_ + 1, vertex_id) - numa_ranges_ - 1;
+}
+
+bool BasicGraph::IsCompressed(GraphType type)const{
+  type = Stored(type);
+  WaitForView(type);
+  return graphs_[ static_cast<int>(type) ].compressed.offsets != 0;
+}
+
+int BasicGraph::DecodeNeighbors(int vertex_id, int *buffer, GraphType type)const{
+  type = Stored(type);
+  Materialize(type);
+  const BasicGraphImpl &g = graphs_[static_cast<int>(type)].Local();
+  long long start = g.boundaries.Start(vertex_id);
+  int degree = g.boundaries[vertex_id] - start;
+  if (g.compressed.offsets)
+    StreamVByte::Decode(g.compressed.data + g.compressed.offsets[vertex_id], degree, g.compressed.sorted, buffer);
+  else
+    memcpy(buffer, g.targets + start, sizeof(int) * degree);
+  return degree;
+}
+
+NeighborIterator BasicGraph::GetNeighborIterator(int vertex_id, GraphType type)const{
+  type = Stored(type);
+  Materialize(type);
+  const BasicGraphImpl &g = graphs_[static_cast<int>(type)].Local();
+  long long start = g.boundaries.Start(vertex_id);
+  int degree = g.boundaries[vertex_id] - start;
+  if (g.compressed.offsets)
+    return NeighborIterator(g.compressed.data + g.compressed.offsets[vertex_id], degree, g.compressed.sorted);
+  return NeighborIterator(g.targets + start, degree);
+}
+
+void BasicGraph::CheckPlain(GraphType type)const{
+  if (IsCompressed(type))
+    throw std::runtime_error("Graph " + CONVERT_TO_STRING(type) + " is compressed, decompress it first");
+}
+
+void BasicGraph::Materialize(GraphType type)const{
+  type = Stored(type);
+  if (graphs_[static_cast<int>(type)].IsReady())
+    return;
+  //a view LoadAsync is still reading is waited for, not built a second time
+  WaitForView(type);
+  if (graphs_[static_cast<int>(type)].IsReady())
+    return;
+  //derived views are built once, by whichever caller gets here first
+  std::lock_guard<std::mutex> lock(materialize_mutex_);
+  WaitForView(OUT);
+  WaitForView(IN);
+  const_cast<BasicGraph*>(this)->Generate(type);
+}
+
+void BasicGraph::MaterializeViews(const int parameter)const{
+  if (undirected_)
+    return;
+  const int view_parameters[]={kIn, kIntersect, kUnion};
+  GraphType types[]={IN, INTERSECTION, UNION};
+  int missing = 0;
+  for(int i=0; i<BAD-1; i++)
+    if (parameter & view_parameters[i]){
+      WaitForView(types[i]);
+      if (!graphs_[ static_cast<int>(types[i]) ].IsReady())
+        missing |= view_parameters[i];
+    }
+  if (!missing)
+    return;
+  std::lock_guard<std::mutex> lock(materialize_mutex_);
+  WaitForView(OUT);
+  WaitForView(IN);
+  BasicGraph *self = const_cast<BasicGraph*>(this);
+  if (missing & kIn)
+    self->Reverse();
+  if (missing & ( kIntersect | kUnion ))
+    self->Combine(missing & ( kIntersect | kUnion ));
+}
+
+void BasicGraph::WaitForView(GraphType type)const{
+  const std::shared_future<void>& pending = pending_[ static_cast<int>(type) ];
+  if (pending.valid())
+    pending.get();
+}
+
+void BasicGraph::WaitForLoads(){
+  //the tasks write into graphs_, none may outlive what they write to
+  for(int i=0; i<BAD; i++)
+    if (pending_[i].valid()){
+      pending_[i].wait();
+      pending_[i] = std::shared_future<void>();
+    }
 }
 
 void BasicGraph::Generate(GraphType type){
@@ -341,151 +1645,238 @@ void BasicGraph::Generate(GraphType type){
   }
 }
 
+void BasicGraph::BasicGraphImpl::AllocateBoundaries(int number_vertex, bool wide){
+  size_t element_size = wide ? sizeof(long long) : sizeof(int);
+  GraphMemory::Release(boundaries_block);
+  boundaries_block = GraphMemory::Allocate( element_size * number_vertex );
+  boundaries.Bind(boundaries_block.address, element_size);
+}
+
+void BasicGraph::BasicGraphImpl::AllocateTargets(long long number_edges){
+  GraphMemory::Release(targets_block);
+  targets_block = GraphMemory::Allocate( sizeof(int) * number_edges );
+  targets = static_cast<int*>(targets_block.address);
+}
+
 void BasicGraph::BasicGraphImpl::Clear(){
-  generated=0;
+  //a LoadAsync task clears its view while readers may be polling IsReady
+  __atomic_store_n(&generated, false, __ATOMIC_RELAXED);
+  sorted=0;
   number_edges=0;
-  ArraySet(boundaries);
-  ArraySet(targets);
+  GraphMemory::Release(boundaries_block);
+  GraphMemory::Release(targets_block);
+  GraphMemory::Release(compressed.offsets_block);
+  GraphMemory::Release(compressed.data_block);
+  DropReplicas();
+  boundaries.Reset();
+  targets=0;
+  compressed=CompressedTargets();
+}
+
+void BasicGraph::BasicGraphImpl::DropReplicas(){
+  for(int i=0; i<number_replicas; i++)
+    replicas[i].Clear();
+  delete[] replicas;
+  replicas=0;
+  number_replicas=0;
+}
+
+const int* BasicGraph::BasicGraphImpl::List(int vertex, std::vector<int>& buffer)const{
+  long long start = boundaries.Start(vertex);
+  if (!compressed.offsets)
+    return targets + start;
+  int degree = boundaries[vertex] - start;
+  buffer.resize(degree + 1);
+  StreamVByte::Decode(compressed.data + compressed.offsets[vertex], degree, compressed.sorted, buffer.data());
+  return buffer.data();
+}
+
+void BasicGraph::BasicGraphImpl::DecodeTargets(int number_vertex, int *out)const{
+  ForEachVertexBlock(boundaries, number_vertex, [&](int thread_id, int begin, int end){
+      for(int i=begin; i<end; i++){
+        long long start = boundaries.Start(i);
+        StreamVByte::Decode(compressed.data + compressed.offsets[i], boundaries[i] - start, compressed.sorted, out + start);
+      }
+    });
 }
 
 void BasicGraph::Reverse(){
-  mProcess reverse_process("Reverse graph generation", number_vertex_, verbose_, 1000);
-  reverse_process.Start();
   BasicGraphImpl& origin=graphs_[static_cast<int>(OUT)];
   BasicGraphImpl& derived=graphs_[static_cast<int>(IN)];
   if (derived.generated)
     return;
+  mProcess reverse_process("Reverse graph generation", 1, verbose_);
+  reverse_process.Start();
   derived.Clear();
-  derived.generated=1;
   derived.number_edges=origin.number_edges;
-  ArraySet(derived.boundaries, number_vertex_);
-  ArraySet(derived.targets, origin.number_edges);
-
-  for(int j=0; j<origin.number_edges; j++){
-    derived.boundaries[ origin.targets[j] ]++;
-  }
-  for(int i=1; i<number_vertex_; i++)
-    derived.boundaries[i]+=derived.boundaries[i-1];
-
-  int j=0;
-  std::vector<int> now(derived.boundaries, derived.boundaries + number_vertex_);
-  //  assert( (*now.rbegin()) == derived.number_edges);
-  for(int i=0; i<number_vertex_; i++){
-    for(; j<origin.boundaries[i]; j++){
-      int y=origin.targets[j];
-      derived.targets[--now[y]]=i;
-    }
-    reverse_process.Update(i);
-  }
-  
-  now.clear();
-  reverse_process.Stop();
-}
+  derived.AllocateBoundaries(number_vertex_, origin.boundaries.IsWide());
+  derived.AllocateTargets(origin.number_edges);
 
-void BasicGraph::Intersect(){
-  Reverse();
-  BasicGraphImpl& origin=graphs_[static_cast<int>(OUT)];
-  BasicGraphImpl& intermediate=graphs_[static_cast<int>(IN)];
-  BasicGraphImpl& derived=graphs_[static_cast<int>(INTERSECTION)];
-  if (derived.generated)
-    return;
-  derived.Clear();
-  derived.generated=1;
-  ArraySet(derived.boundaries, number_vertex_);
-
-  static std::vector<int> visited, now;
-  visited.resize(number_vertex_);
-  static int version=10;
-
-  mProcess intersect_process("Intersection graph generation", 2 * number_vertex_, verbose_, 1000);
-  intersect_process.Start();
-  
-  for(int o=0; o<1; o++){
-    for(int i=0, j=0, j1=0; i<number_vertex_; i++){
-      version++;
-      //mark all outpoints in OUT
-      for(; j<origin.boundaries[i]; j++){
-        int y=origin.targets[j];
-        visited[y]=version;
+  //the edges are first partitioned by destination bucket, every thread
+  //counting and then copying the edges of its OUT block, so that a bucket
+  //holds its edges by increasing source
+  int threads = mParallel::Threads();
+  int buckets = ( number_vertex_ >> kReverseBucketBits ) + 1;
+  std::vector<long long> positions( static_cast<long long>(buckets) * threads + 1, 0 );
+  //a compressed OUT is decoded list by list, twice
+  ForEachVertexBlock(origin.boundaries, number_vertex_, [&](int thread_id, int begin, int end){
+      std::vector<long long> count(buckets);
+      std::vector<int> buffer;
+      for(int i=begin; i<end; i++){
+        const int *list = origin.List(i, buffer);
+        for(long long j=0, degree=origin.boundaries[i]-origin.boundaries.Start(i); j<degree; j++)
+          count[ list[j] >> kReverseBucketBits ]++;
       }
-      for(; j1<intermediate.boundaries[i]; j1++){
-        int y=intermediate.targets[j1];
-        if (visited[y] == version){
-          //you assert that (i,j) exist both in OUT and IN, thus in INTERSECTION too
-          if (o == 0){
-            derived.number_edges++;
-            derived.boundaries[i]++;
-          }else{
-            derived.targets[ --now[i] ] = y;
-          }
+      for(int b=0; b<buckets; b++)
+        positions[ static_cast<long long>(b) * threads + thread_id ] = count[b];
+    });
+  long long offset = 0;
+  for(size_t i=0; i<positions.size(); i++){
+    long long count = positions[i];
+    positions[i] = offset;
+    offset += count;
+  }
+  struct Edge{
+    int source;
+    int target;
+  };
+  MemoryBlock edges_block = GraphMemory::Allocate( sizeof(Edge) * origin.number_edges );
+  Edge *edges = static_cast<Edge*>(edges_block.address);
+  ForEachVertexBlock(origin.boundaries, number_vertex_, [&](int thread_id, int begin, int end){
+      std::vector<long long> cursor(buckets);
+      for(int b=0; b<buckets; b++)
+        cursor[b] = positions[ static_cast<long long>(b) * threads + thread_id ];
+      std::vector<int> buffer;
+      for(int i=begin; i<end; i++){
+        const int *list = origin.List(i, buffer);
+        for(long long j=0, degree=origin.boundaries[i]-origin.boundaries.Start(i); j<degree; j++){
+          Edge edge = { i, list[j] };
+          edges[ cursor[ edge.target >> kReverseBucketBits ]++ ] = edge;
         }
       }
-      intersect_process.Update( o * number_vertex_ + i );
-    }
-    if (o == 0){
-      for(int i=1; i<number_vertex_; i++)
-        derived.boundaries[i]+=derived.boundaries[i-1];
-      now=std::vector<int>(derived.boundaries, derived.boundaries + number_vertex_);
-      ArraySet(derived.targets, derived.number_edges);
-    }
-  }
+    });
 
-  now.clear();
-  intersect_process.Stop();
+  //then every bucket is transposed on its own, its counters and the part of
+  //the targets it writes stay in cache. a stable scatter keeps the lists sorted
+  std::vector<long long> bucket_ends(buckets);
+  for(int b=0; b<buckets; b++)
+    bucket_ends[b] = positions[ static_cast<long long>(b+1) * threads ];
+  EdgeOffsets bucket_offsets;
+  bucket_offsets.Bind(&bucket_ends[0], sizeof(long long));
+  ForEachVertexBlock(bucket_offsets, buckets, [&](int thread_id, int begin, int end){
+      std::vector<long long> cursor(1 << kReverseBucketBits);
+      for(int b=begin; b<end; b++){
+        int first = b << kReverseBucketBits;
+        int last = std::min(number_vertex_, first + ( 1 << kReverseBucketBits ));
+        std::fill(cursor.begin(), cursor.end(), 0);
+        for(long long j=bucket_offsets.Start(b); j<bucket_offsets[b]; j++)
+          cursor[ edges[j].target - first ]++;
+        long long offset = bucket_offsets.Start(b);
+        for(int i=first; i<last; i++){
+          long long count = cursor[i - first];
+          cursor[i - first] = offset;
+          offset += count;
+          derived.boundaries.Set(i, offset);
+        }
+        for(long long j=bucket_offsets.Start(b); j<bucket_offsets[b]; j++)
+          derived.targets[ cursor[ edges[j].target - first ]++ ] = edges[j].source;
+      }
+    });
+  GraphMemory::Release(edges_block);
+  derived.sorted=1;
+  derived.Publish();
+  reverse_process.Stop();
+}
+
+void BasicGraph::Intersect(){
+  Combine(kIntersect);
 }
 
 void BasicGraph::Union(){
-  mProcess union_process("Union graph generation", 2 * number_vertex_, verbose_, 1000);
-  BasicGraphImpl& origin=graphs_[static_cast<int>(OUT)];
-  BasicGraphImpl& intermediate=graphs_[static_cast<int>(IN)];
-  BasicGraphImpl& derived=graphs_[static_cast<int>(UNION)];
-  if (derived.generated)
+  Combine(kUnion);
+}
+
+void BasicGraph::Combine(const int parameter){
+  Reverse();
+  const BasicGraphImpl& origin=graphs_[static_cast<int>(OUT)];
+  const BasicGraphImpl& intermediate=graphs_[static_cast<int>(IN)];
+  //either view is left out when it is not asked for or already there
+  BasicGraphImpl *intersection=&graphs_[static_cast<int>(INTERSECTION)];
+  BasicGraphImpl *unite=&graphs_[static_cast<int>(UNION)];
+  if ( !(parameter & kIntersect) || intersection->generated )
+    intersection = 0;
+  if ( !(parameter & kUnion) || unite->generated )
+    unite = 0;
+  if (!intersection && !unite)
     return;
-  derived.Clear();
-  derived.generated=1;
-  ArraySet(derived.boundaries, number_vertex_);
-  
-  static std::vector<int> visited, now;
-  visited.resize(number_vertex_);
-  static int version=10;
-
-  union_process.Start();
-
-  for(int o=0; o<1; o++){
-    for(int i=0, j=0, j1=0; i<number_vertex_; i++){
-      version++;
-      //mark all outpoints in OUT
-      for(; j<origin.boundaries[i]; j++){
-        int y=origin.targets[j];
-        visited[y]=version;
-        if (o==0){
-          derived.number_edges++;
-          derived.boundaries[i]++;
-        }else{
-          derived.targets[ --now[i] ] = y;
-        }
-      }
-      for(; j1<intermediate.boundaries[i]; j1++){
-        int y=intermediate.targets[j1];
-        if (visited[y] != version){
-          if (o==0){
-            derived.number_edges++;
-            derived.boundaries[i]++;
+  mProcess combine_process(!unite ? "Intersection graph generation" :
+                           !intersection ? "Union graph generation" : "Intersection and union graph generation", 1, verbose_);
+  combine_process.Start();
+
+  //the OUT and IN lists of every vertex are merged twice, once to size the
+  //results and once to write them, both views come out of the same sweep.
+  //lists that are not strictly increasing are sorted into a buffer first,
+  //so the results are sorted and duplicate free. compressed lists are decoded first
+  BasicGraphImpl *derived[2] = { intersection, unite };
+  MemoryBlock counts_blocks[2];
+  long long *counts[2] = { 0, 0 };
+  for(int k=0; k<2; k++)
+    if (derived[k]){
+      derived[k]->Clear();
+      counts_blocks[k] = GraphMemory::Allocate( sizeof(long long) * number_vertex_ );
+      counts[k] = static_cast<long long*>(counts_blocks[k].address);
+    }
+  auto merge = [&](bool write){
+    ForEachVertexBlock(origin.boundaries, number_vertex_, [&](int thread_id, int begin, int end){
+        std::vector<int> out_buffer, in_buffer, out_decoded, in_decoded;
+        for(int i=begin; i<end; i++){
+          size_t out_size = origin.boundaries[i] - origin.boundaries.Start(i);
+          size_t in_size = intermediate.boundaries[i] - intermediate.boundaries.Start(i);
+          const int *out_list = SortedSets::Normalize(origin.List(i, out_decoded), out_size, out_buffer);
+          const int *in_list = SortedSets::Normalize(intermediate.List(i, in_decoded), in_size, in_buffer);
+          if (write){
+            int *intersection_result = intersection ? intersection->targets + intersection->boundaries.Start(i) : 0;
+            int *union_result = unite ? unite->targets + unite->boundaries.Start(i) : 0;
+            size_t common;
+            if (intersection && unite)
+              SortedSets::IntersectionUnion(out_list, out_size, in_list, in_size, intersection_result, union_result, common);
+            else
+              if (intersection)
+                SortedSets::Intersection(out_list, out_size, in_list, in_size, intersection_result);
+              else
+                SortedSets::Union(out_list, out_size, in_list, in_size, union_result);
           }else{
-            derived.targets[ --now[i] ] = y;
+            //the union is what the intersection leaves over
+            long long common = SortedSets::IntersectionSize(out_list, out_size, in_list, in_size);
+            if (intersection)
+              counts[0][i] = common;
+            if (unite)
+              counts[1][i] = out_size + in_size - common;
           }
         }
-      }
-      union_process.Update( o * number_vertex_ + i );
-    }
-    if (o == 0){
-      for(int i=1; i<number_vertex_; i++)
-        derived.boundaries[i]+=derived.boundaries[i-1];
-      now=std::vector<int>(derived.boundaries, derived.boundaries + number_vertex_);
-      ArraySet(derived.targets, derived.number_edges);
-    }
+      });
+  };
+  merge(0);
+  for(int k=0; k<2; k++){
+    if (!derived[k])
+      continue;
+    BasicGraphImpl& view=*derived[k];
+    long long *view_counts=counts[k];
+    mParallel::PrefixSum(view_counts, number_vertex_);
+    view.number_edges = number_vertex_ ? view_counts[number_vertex_-1] : 0;
+    view.AllocateBoundaries(number_vertex_, origin.boundaries.IsWide() || EdgeOffsets::NeedsWide(view.number_edges));
+    mParallel::For(0, number_vertex_, [&](int thread_id, long long begin, long long end){
+        for(long long i=begin; i<end; i++)
+          view.boundaries.Set(i, view_counts[i]);
+      });
+    GraphMemory::Release(counts_blocks[k]);
+    view.AllocateTargets(view.number_edges);
   }
-  
-  now.clear();
-  union_process.Stop();
+  merge(1);
+  for(int k=0; k<2; k++)
+    if (derived[k]){
+      derived[k]->sorted=1;
+      derived[k]->Publish();
+    }
+  combine_process.Stop();
 }
@@ -2,10 +2,18 @@
 #define BASIC_GRAPH_
 
 #include "utility.h"
+#include "graph_memory.h"
+#include "graph_format.h"
+#include "graph_compress.h"
+#include "graph_offsets.h"
+#include "graph_generator.h"
+#include "graph_ids.h"
 #include <string>
 #include <cassert>
 #include <ctime>
+#include <future>
 #include <map>
+#include <mutex>
 #include <vector>
 
 const int kBinary = 1 << 0;
@@ -16,6 +24,31 @@ const int kIntersect = 1 << 4;
 const int kUnion = 1 << 5;
 const int kMapping = 1 << 6;
 const int kALL = ( 1 << 7 ) - 1;
+//loading hints, binary files only
+const int kMapped = 1 << 7;
+const int kPopulate = 1 << 8;
+const int kWillNeed = 1 << 9;
+//single-file container <base_path>.graph instead of the .imp_* files
+const int kContainer = 1 << 10;
+//check the section checksums of a mapped container as well
+const int kVerify = 1 << 11;
+//edge list ingestion
+const int kDeduplicate = 1 << 12;
+const int kNoSelfLoops = 1 << 13;
+//replace files left by an earlier Save, every file is published by an atomic rename
+const int kOverwrite = 1 << 14;
+//64-bit edge offsets even when the edges would fit 32-bit ones
+const int kWideOffsets = 1 << 15;
+//every edge is stored in both directions in OUT alone, the other views are OUT
+const int kUndirected = 1 << 16;
+//the ids of an edge list are sparse 64-bit keys: the vertices are numbered by
+//increasing key and the keys are kept as the raw ids
+const int kSparseIds = 1 << 17;
+
+//a binary .ind holding this edge count is followed by the 64-bit count.
+//the .ind of a view ends with its GraphSection flags, files that predate
+//them are taken as unsorted
+const int kWideEdgeCount = -1;
 
 static double RandUnity(){  return rand() * 1.0 / RAND_MAX; }
 
@@ -57,6 +90,21 @@ static GraphType GetDualGraphType(GraphType type){
   }
 }
 
+//vertex orders of BasicGraph::Reorder, see graph_order.h
+enum VertexOrder{
+  kDegreeOrder,
+  kRCMOrder,
+  kGorder
+};
+
+//NUMA placements of BasicGraph::PlaceOnNodes
+enum NumaPlacement{
+  kNumaFirstTouch,  //pages stay where the thread that wrote them first runs
+  kNumaInterleave,
+  kNumaReplicate,
+  kNumaPartition
+};
+
 class BasicGraph{
 
   //in the effect of shard memory, it's
@@ -66,12 +114,20 @@ class BasicGraph{
 
   explicit BasicGraph(bool verbose = 0);
   explicit BasicGraph(const std::string& base_path, bool verbose = 0);
-  //explicit BasicGraph(const BasicGraph& graph, const std::vector<int> subgraph_ids, bool raw = 1, bool verbose_ = 0);
+  //the subgraph induced by subgraph_ids, raw ids unless raw is false. the
+  //vertices keep their relative order, so sorted lists stay sorted, and the
+  //raw ids of graph stay theirs through the RawId functions. every view
+  //resident in graph is carved out in parallel, the others are built on use
+  explicit BasicGraph(const BasicGraph& graph, const std::vector<int>& subgraph_ids, bool raw = 1, bool verbose = 0);
+  //the same by 64-bit raw ids, the keys of a kSparseIds graph
+  explicit BasicGraph(const BasicGraph& graph, const std::vector<long long>& raw_ids, bool verbose = 0);
   ~BasicGraph();
 
   int GetNumberVertex() const { return number_vertex_; }
 
-  int GetNumerEdges(GraphType type = OUT) const {
+  long long GetNumerEdges(GraphType type = OUT) const {
+    type = Stored(type);
+    Materialize(type);
     return graphs_[ static_cast<int>(type) ].number_edges;
   }
 
@@ -79,49 +135,237 @@ class BasicGraph{
   void SetVerbose(bool verbose) { verbose_ = verbose; }
   
   void Clear();
-  void Load(const std::string& base_path); 
+  void Load(const std::string& base_path, const int parameter = 0);
+  //same as Load, but every view is read by its own task in the background and
+  //the call returns once the vertex count is known. the accessors wait for the
+  //view they need only, the future completes when all of them are resident
+  //and rethrows the first error. a mapped container is attached at once
+  std::shared_future<void> LoadAsync(const std::string& base_path, const int parameter = 0);
+  bool IsResident(GraphType type = OUT) const { return graphs_[ static_cast<int>( Stored(type) ) ].IsReady(); }
+  bool HasWideOffsets(GraphType type = OUT) const { return graphs_[ static_cast<int>( Stored(type) ) ].boundaries.IsWide(); }
+  //the pages holding the targets of a view, see GraphMemory::SetHugePages.
+  //a view read in place from a container reports the pages of the image,
+  //small ones for an image handed to AttachImage
+  HugePages GetHugePages(GraphType type = OUT) const;
+  //every list of the view is in increasing order, duplicates allowed. views
+  //built here always are, loaded ones when the files say so
+  bool IsSorted(GraphType type = OUT) const {
+    type = Stored(type);
+    Materialize(type);
+    return graphs_[ static_cast<int>(type) ].sorted;
+  }
   void Save(const std::string& base_path, const int parameter = kALL) const;
+  //the container image Save writes with kContainer, held in memory instead:
+  //WriteImage fills the ImageSize bytes at image with all threads. every
+  //array is found by its offset, so the image can be read at any address
+  size_t ImageSize(const int parameter = kALL) const;
+  void WriteImage(char *image, const int parameter = kALL) const;
+  //reads the views and the mapping of an image in place, nothing is copied
+  //and the image must outlive the graph or its next Load. kVerify checks the
+  //section checksums first
+  void AttachImage(const char *image, size_t length, const int parameter = 0);
+  //plain "src dst" lists, SNAP text and Matrix Market coordinate files,
+  //kDeduplicate and kNoSelfLoops clean the OUT lists while they are built
+  //kWideOffsets stores the OUT offsets 64-bit whatever the edge count,
+  //kUndirected adds every edge in both directions, once, kSparseIds takes
+  //the ids as 64-bit keys
+  void LoadEdgeList(const std::string& path, const int parameter = 0);
+  //edge_factor is the density of the graph here, the edges drawn are
+  //edge_factor * n * (n-1). the ids are not permuted and the seed is fixed
   void GenerateRMATGraph(int n_scale=10, double edge_factor=0.9, double a=0.60, double b=0.20, double c=0.15);
+  //Graph500 style generation, parameter accepts kDeduplicate, kNoSelfLoops and kWideOffsets
+  void GenerateRMATGraph(const RMATOptions& options, const int parameter = kDeduplicate);
+  //the generators of graph_generator.h, deterministic for a seed. parameter
+  //is passed on to the CSR construction as for GenerateRMATGraph
+  void GenerateErdosRenyiGraph(int number_vertex, long long number_edges, uint64_t seed = 1, const int parameter = 0);
+  //a Barabasi-Albert edge may copy its own source, so vertex 0 loops on itself
+  //and later vertices now and then do, kNoSelfLoops drops those edges
+  void GenerateBarabasiAlbertGraph(int number_vertex, int edges_per_vertex, uint64_t seed = 1, const int parameter = kDeduplicate);
+  void GenerateWattsStrogatzGraph(int number_vertex, int degree, double rewiring, uint64_t seed = 1, const int parameter = kDeduplicate);
+  void GenerateGridGraph(int x, int y, int z = 1, bool torus = 0, const int parameter = 0);
+  void GenerateStochasticBlockGraph(const std::vector<int>& block_sizes, const std::vector<double>& probabilities,
+                                    uint64_t seed = 1, const int parameter = 0);
+
+  //IN, INTERSECTION and UNION are built from OUT the first time they are used
+  //unless they were loaded, Materialize builds one ahead of time. safe to call
+  //from several threads, the view is built once
+  void Materialize(GraphType type) const;
+
+  //an undirected graph keeps a single symmetric view, every GraphType reads
+  //it and its edge counts hold every edge twice. Symmetrize turns a directed
+  //graph into one by keeping UNION as OUT and dropping the other views
+  bool IsUndirected() const { return undirected_; }
+  void Symmetrize();
+  //builds the views whose kIn, kIntersect and kUnion bits are set, INTERSECTION
+  //and UNION come out of one sweep over OUT and IN when both are missing
+  void MaterializeViews(const int parameter = kIn | kIntersect | kUnion) const;
+
+  //sorts every list of a view in parallel, kDeduplicate and kNoSelfLoops drop
+  //repeated neighbors and the vertex itself. when OUT loses edges the views
+  //derived from it are dropped and built again on first use. the offsets are
+  //64-bit afterwards only with kWideOffsets or when the edges need it
+  void Canonicalize(GraphType type = OUT, const int parameter = kDeduplicate | kNoSelfLoops);
+  //binary search in sorted views, a scan otherwise
+  bool HasEdge(int source, int target, GraphType type = OUT) const;
+
+  //relabels the vertices of every resident view in parallel, the other views
+  //are built again from OUT when they are used. the raw ids, those before the
+  //first Reorder or the keys of a kSparseIds edge list, stay available through
+  //the RawId functions and are saved with kMapping. the second form takes the
+  //old ids in their new order
+  void Reorder(VertexOrder order);
+  void Reorder(const std::vector<int>& order);
+  bool HasMapping() const { return to_raw_ != 0; }
+
+  //NUMA placement of the views resident now, nodes 0 takes those of the
+  //machine and more are folded onto them, see GraphMemory::NumaNodes.
+  //kNumaInterleave spreads the pages over the nodes, kNumaReplicate gives each
+  //node a copy and every read goes to the copy of the node of its thread,
+  //kNumaPartition splits the vertices into ranges of about the same number of
+  //OUT edges and keeps the lists of a range on its owner node in every view.
+  //compressed views are only replicated, the other placements leave them be.
+  //mapped and borrowed arrays are copied first, the kernel does not move the
+  //pages of a shared file. not while the graph is read. false when the kernel
+  //refused to move some pages, the layout is in place anyway. the views built
+  //later are not placed, Canonicalize, Compress, Reorder and Symmetrize drop
+  //the copies and go back to kNumaFirstTouch
+  bool PlaceOnNodes(NumaPlacement placement, int nodes = 0);
+  NumaPlacement GetNumaPlacement() const { return numa_placement_; }
+  int GetNumaNodes() const { return numa_nodes_; }
+  //the owner node of a vertex under kNumaPartition, 0 otherwise
+  int GetVertexNode(int vertex_id) const;
 
-  //mapping
-  //^
   void Dump(GraphType type = OUT, int range = 10)const;
 
   int GetDegree(int vertex_id, GraphType type = OUT) const;
   std::vector<int> GetNeighbors(int vertex_id, GraphType type = OUT) const;
   std::pair<const int*, const int*> GetNeighborsIterators(int vertex_id, GraphType type = OUT) const;
 
-  int FromRawId(int raw_id) const; 
-  int ToRawId(int id) const;
-  std::vector<int> FromRawIds(const std::vector<int> &raw_ids) const;
-  std::vector<int> ToRawIds(const std::vector<int> &ids) const;
+  //a compressed view keeps its boundaries and stores the targets StreamVByte encoded,
+  //read it through DecodeNeighbors, GetNeighborIterator or GetNeighbors. the views
+  //derived from it decode its lists as they are built, Save writes them decoded
+  //and Reorder encodes them again once they are relabeled
+  void Compress(GraphType type);
+  void Decompress(GraphType type);
+  bool IsCompressed(GraphType type = OUT) const;
+  //buffer must hold GetDegree(vertex_id, type) ints, returns the degree
+  int DecodeNeighbors(int vertex_id, int *buffer, GraphType type = OUT) const;
+  NeighborIterator GetNeighborIterator(int vertex_id, GraphType type = OUT) const;
+
+  //the identity while there is no mapping, FromRawId is -1 for an unknown raw id.
+  //the batch forms prefetch ahead and split large batches over the threads
+  int FromRawId(long long raw_id) const {
+    if (to_raw_)
+      return from_raw_.Find(raw_id);
+    return raw_id >= 0 && raw_id < number_vertex_ ? static_cast<int>(raw_id) : -1;
+  }
+  long long ToRawId(int id) const { return to_raw_ ? to_raw_[id] : id; }
+  std::vector<int> FromRawIds(const std::vector<long long> &raw_ids) const;
+  std::vector<long long> ToRawIds(const std::vector<int> &ids) const;
 
  private:
   
   struct BasicGraphImpl{
 
-  BasicGraphImpl(): generated(0), number_edges(0), boundaries(0), targets(0){}
+  BasicGraphImpl(): generated(0), sorted(0), number_edges(0), targets(0), replicas(0), number_replicas(0){}
     ~BasicGraphImpl(){}
     
     bool generated;
-    int number_edges;
-    int *boundaries;
+    bool sorted;
+    long long number_edges;
+    EdgeOffsets boundaries;
     int *targets;
+    //either heap memory or read-only pages mapped from a _bin file,
+    //both are empty when the arrays point into image_block_
+    MemoryBlock boundaries_block;
+    MemoryBlock targets_block;
+    CompressedTargets compressed;
+    //the copies of kNumaReplicate, replica i is on node i
+    BasicGraphImpl *replicas;
+    int number_replicas;
 
+    //generated is set with release semantics once a view is complete,
+    //readers that see it set see the whole view
+    void Publish(){ __atomic_store_n(&generated, true, __ATOMIC_RELEASE); }
+    bool IsReady() const { return __atomic_load_n(&generated, __ATOMIC_ACQUIRE); }
+    void AllocateBoundaries(int number_vertex, bool wide);
+    void AllocateTargets(long long number_edges);
     void Clear();
+    void DropReplicas();
+    //the list of vertex, in place when the view is plain and decoded into
+    //buffer when it is compressed
+    const int* List(int vertex, std::vector<int>& buffer) const;
+    //every list of a compressed view, decoded with all threads
+    void DecodeTargets(int number_vertex, int *out) const;
+    //the replica of the node of the calling thread, the view itself without them
+    const BasicGraphImpl& Local() const {
+      return replicas ? replicas[ GraphMemory::CurrentNode(number_replicas) ] : *this;
+    }
   };
 
+  void LoadIndex(const std::string& base_path);
+  void LoadViews(const std::string& base_path, const int parameter);
+  void LoadView(const std::string& base_path, const GraphType type, const int parameter);
   void LoadImpl(const std::string& base_path, const GraphType type, const int parameter);
   void SaveImpl(const std::string& base_path, const GraphType type, const int parameter)const;
+  void LoadContainer(const std::string& path, const int parameter);
+  std::vector<GraphSection> LoadSectionTable(const std::string& path);
+  void LoadContainerView(const std::string& path, const std::vector<GraphSection>& sections, const GraphType type);
+  void LoadSparseEdgeList(const std::string& path, const int parameter);
+  void LoadMapping(const std::string& base_path, const int parameter);
+  void SaveMapping(const std::string& base_path, const int parameter)const;
+  void BindMapping(long long *to_raw, const MemoryBlock& block);
+  void BindIndex(const IdSlot *slots, uint64_t capacity, const MemoryBlock& block);
+  void IndexMapping();
+  void Relabel(GraphType type, const int *order, const int *new_ids);
+  bool PlaceView(BasicGraphImpl& g, NumaPlacement placement, int nodes);
+  //drops the copies of every view and forgets the placement
+  void ResetPlacement();
+  void SaveContainer(const std::string& path, const int parameter)const;
+  void BindImage(const char *image, size_t length, const std::string& name, const int parameter);
+  void ContainerLayout(const int parameter, GraphFileHeader& header, GraphSection *sections)const;
+  void BindSection(const GraphSection& section, char *address, const MemoryBlock& block);
+  //throws when the bound arrays of a view disagree on its edge count
+  void CheckBoundView(const GraphSection *sections, size_t number_sections, GraphType type, const std::string& path)const;
+  const char* SectionData(const GraphSection& section)const;
+  void CheckPlain(GraphType type)const;
+  void AssignEdges(int number_vertex, const int *sources, const int *targets, long long number_edges, const int parameter);
+  void WaitForView(GraphType type)const;
+  void WaitForLoads();
   void Generate(GraphType type);
   void Reverse();
   void Intersect();
   void Union();
+  void Combine(const int parameter);
+  GraphType Stored(GraphType type) const { return undirected_ ? OUT : type; }
+  //the views of an undirected graph are all OUT, it is saved once
+  int SavedViews(const int parameter) const { return undirected_ ? parameter & ~( kIn | kIntersect | kUnion ) : parameter; }
 
   int number_vertex_;
-  int number_edges_;
+  long long number_edges_;
 
   BasicGraphImpl graphs_[BAD];
+
+  //the whole container file when it was loaded with kMapped
+  MemoryBlock image_block_;
+
+  //raw id of every vertex and the index back, both may point into a mapped
+  //image, from_raw_ is built again when the image has no index
+  long long *to_raw_;
+  IdIndex from_raw_;
+  MemoryBlock to_raw_block_;
+  MemoryBlock from_raw_block_;
+
+  //views still being read by LoadAsync
+  std::shared_future<void> pending_[BAD];
+  mutable std::mutex materialize_mutex_;
+
+  NumaPlacement numa_placement_;
+  int numa_nodes_;
+  //first vertex of the range of every node under kNumaPartition
+  int numa_ranges_[GraphMemory::kMaxNumaNodes + 1];
+
+  bool undirected_;
   
   bool verbose_;
 
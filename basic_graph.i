@@ -8,6 +8,7 @@
 
 namespace std{
   %template(vector_int) vector<int>;
+  %template(vector_ll) vector<long long>;
    %template(vector_ii) vector<vector<int> >;
 }
 
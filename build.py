@@ -1,6 +1,7 @@
 #!/usr/local/bin/python3
 
 import argparse
+import glob
 import os
 import os.path
 import sys
@@ -59,10 +60,16 @@ def main(args):
     
     my_execute("swig", "-python", "-c++", "-py3", "-builtin", "-module", module_name, "-outdir", build_path, "-o", wrapper_path, interface_path)
     
-    compile_args=["c++", "-O3", "-Wall", "-std=c++11", "-shared", "-fPIC", "-I"+dir_path]
+    compile_args=["c++", "-O3", "-Wall", "-std=c++11", "-pthread", "-shared", "-fPIC", "-I"+dir_path]
     compile_args.append(args.source[0])
     compile_args.append(wrapper_path)
     compile_args.extend(args.additional_sources)
+    #basic_graph is split over the graph_*.cc modules next to it, they are
+    #linked in unless they were named with -a already
+    named=set(os.path.abspath(path) for path in [source_full]+args.additional_sources)
+    for module in sorted(glob.glob(os.path.join(dir_path, "graph_*.cc"))):
+        if os.path.abspath(module) not in named:
+            compile_args.append(module)
     compile_args.extend(['-o', extension_path])
 
     python_include_path=args.python_include_path if args.python_include_path else python_config.PYTHON_INCLUDE_PATH
@@ -0,0 +1,128 @@
+#include "graph_compress.h"
+#include <cstring>
+#if defined(__x86_64__) || defined(__i386__)
+#define HK_SSSE3_DECODE
+#include <tmmintrin.h>
+#endif
+
+static int ByteLength(uint32_t value){
+  if (value < ( 1U << 8 ))
+    return 1;
+  if (value < ( 1U << 16 ))
+    return 2;
+  if (value < ( 1U << 24 ))
+    return 3;
+  return 4;
+}
+
+static uint32_t Delta(int value, int previous, bool sorted){
+  return sorted ? static_cast<uint32_t>(value) - static_cast<uint32_t>(previous) :
+    StreamVByte::ZigZag( static_cast<int>( static_cast<uint32_t>(value) - static_cast<uint32_t>(previous) ) );
+}
+
+size_t StreamVByte::EncodedSize(const int *values, int count, bool sorted){
+  size_t size = ( count + 3 ) / 4;
+  for(int i = 0, previous = 0; i < count; previous = values[i++])
+    size += ByteLength( Delta(values[i], previous, sorted) );
+  return size;
+}
+
+size_t StreamVByte::Encode(const int *values, int count, bool sorted, unsigned char *out){
+  unsigned char *control = out;
+  unsigned char *data = out + ( count + 3 ) / 4;
+  memset(control, 0, ( count + 3 ) / 4);
+  for(int i = 0, previous = 0; i < count; previous = values[i++]){
+    uint32_t delta = Delta(values[i], previous, sorted);
+    int length = ByteLength(delta);
+    control[ i >> 2 ] |= ( length - 1 ) << ( ( i & 3 ) * 2 );
+    for(int j = 0; j < length; j++)
+      *data++ = ( delta >> ( 8 * j ) ) & 0xff;
+  }
+  return data - out;
+}
+
+//the scalar decoder, for machines without SSSE3 and for the last values of a list
+//the running value wraps around as the encoder's deltas did, in uint32_t
+static void DecodeScalar(const unsigned char *control, const unsigned char *data, int i, int count, bool sorted, uint32_t last, int *out){
+  for(; i < count; i++){
+    int length = ( ( control[ i >> 2 ] >> ( ( i & 3 ) * 2 ) ) & 3 ) + 1;
+    uint32_t delta = 0;
+    for(int j = 0; j < length; j++)
+      delta |= static_cast<uint32_t>( data[j] ) << ( 8 * j );
+    data += length;
+    last += sorted ? delta : static_cast<uint32_t>( StreamVByte::UnZigZag(delta) );
+    out[i] = static_cast<int>(last);
+  }
+}
+
+#ifdef HK_SSSE3_DECODE
+
+//for every control byte, the shuffle gathering its four values into 32-bit lanes
+//and the number of data bytes it covers
+struct ShuffleTable{
+
+  ShuffleTable(){
+    for(int control = 0; control < 256; control++){
+      int position = 0;
+      for(int lane = 0; lane < 4; lane++){
+        int length = ( ( control >> ( lane * 2 ) ) & 3 ) + 1;
+        for(int byte = 0; byte < 4; byte++)
+          masks[control][ lane * 4 + byte ] = byte < length ? position + byte : -1;
+        position += length;
+      }
+      lengths[control] = position;
+    }
+  }
+
+  signed char masks[256][16];
+  int lengths[256];
+
+};
+
+static const ShuffleTable kShuffleTable;
+
+//only this function is built for SSSE3, the module itself runs on any x86-64
+__attribute__((target("ssse3")))
+static void DecodeSSSE3(const unsigned char *in, int count, bool sorted, int *out){
+  const unsigned char *control = in;
+  const unsigned char *data = in + ( count + 3 ) / 4;
+  __m128i previous = _mm_setzero_si128();
+  const __m128i one = _mm_set1_epi32(1);
+  int i = 0;
+  for(; i + 4 <= count; i += 4){
+    unsigned char code = control[ i >> 2 ];
+    __m128i mask = _mm_loadu_si128( reinterpret_cast<const __m128i*>( kShuffleTable.masks[code] ) );
+    __m128i deltas = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>(data) ), mask );
+    data += kShuffleTable.lengths[code];
+    if (!sorted)
+      deltas = _mm_xor_si128( _mm_srli_epi32(deltas, 1), _mm_sub_epi32( _mm_setzero_si128(), _mm_and_si128(deltas, one) ) );
+    //prefix sum of the four lanes, then add the last value of the previous group
+    deltas = _mm_add_epi32( deltas, _mm_slli_si128(deltas, 4) );
+    deltas = _mm_add_epi32( deltas, _mm_slli_si128(deltas, 8) );
+    deltas = _mm_add_epi32( deltas, previous );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( out + i ), deltas );
+    previous = _mm_shuffle_epi32(deltas, 0xff);
+  }
+  DecodeScalar(control, data, i, count, sorted, i ? static_cast<uint32_t>( out[i-1] ) : 0, out);
+}
+
+//checked once at load time, the cpu model may not be filled in yet when the
+//static constructors run
+static bool HasSSSE3(){
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("ssse3");
+}
+
+static const bool kHasSSSE3 = HasSSSE3();
+
+#endif
+
+void StreamVByte::Decode(const unsigned char *in, int count, bool sorted, int *out){
+#ifdef HK_SSSE3_DECODE
+  if (kHasSSSE3){
+    DecodeSSSE3(in, count, sorted, out);
+    return;
+  }
+#endif
+  DecodeScalar(in, in + ( count + 3 ) / 4, 0, count, sorted, 0, out);
+}
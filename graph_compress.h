@@ -0,0 +1,84 @@
+#ifndef GRAPH_COMPRESS_
+#define GRAPH_COMPRESS_
+
+#include "graph_memory.h"
+#include <cstdint>
+
+//StreamVByte: the byte lengths of four values are packed into one control byte,
+//the values follow as 1-4 little endian bytes each. a neighbor list is stored as
+//the deltas between consecutive neighbors, zigzag encoded unless the list is sorted.
+//the encoded stream of a list is its ceil(count/4) control bytes followed by its data bytes.
+class StreamVByte{
+
+ public:
+
+  //Decode loads 16 bytes at a time, encoded arrays carry that much slack at the end
+  static const int kPadding = 16;
+
+  static size_t EncodedSize(const int *values, int count, bool sorted);
+  static size_t Encode(const int *values, int count, bool sorted, unsigned char *out);
+  //bulk decode, uses SSSE3 shuffles when the machine running it has them
+  static void Decode(const unsigned char *in, int count, bool sorted, int *out);
+
+  static uint32_t ZigZag(int value){
+    return ( static_cast<uint32_t>(value) << 1 ) ^ static_cast<uint32_t>( value >> 31 );
+  }
+  static int UnZigZag(uint32_t value){
+    return static_cast<int>( ( value >> 1 ) ^ ( 0 - ( value & 1 ) ) );
+  }
+
+};
+
+//StreamVByte encoded targets of one view
+struct CompressedTargets{
+
+CompressedTargets(): sorted(0), offsets(0), data(0), data_length(0){}
+
+  bool sorted;
+  uint64_t *offsets;  //number_vertex + 1 byte offsets into data
+  unsigned char *data;
+  uint64_t data_length;  //including kPadding
+  MemoryBlock offsets_block;
+  MemoryBlock data_block;
+
+};
+
+//walks one neighbor list value by value, whether it is stored plainly or compressed
+class NeighborIterator{
+
+ public:
+
+  NeighborIterator(const int *targets, int count):
+  targets_(targets), control_(0), data_(0), sorted_(0), index_(0), count_(count), previous_(0){}
+
+  NeighborIterator(const unsigned char *encoded, int count, bool sorted):
+  targets_(0), control_(encoded), data_( encoded + ( count + 3 ) / 4 ), sorted_(sorted), index_(0), count_(count), previous_(0){}
+
+  bool HasNext() const { return index_ < count_; }
+
+  int Next(){
+    if (targets_)
+      return targets_[ index_++ ];
+    int length = ( ( control_[ index_ >> 2 ] >> ( ( index_ & 3 ) * 2 ) ) & 3 ) + 1;
+    uint32_t delta = 0;
+    for(int i = 0; i < length; i++)
+      delta |= static_cast<uint32_t>( data_[i] ) << ( 8 * i );
+    data_ += length;
+    index_++;
+    previous_ += sorted_ ? delta : static_cast<uint32_t>( StreamVByte::UnZigZag(delta) );
+    return static_cast<int>(previous_);
+  }
+
+ private:
+
+  const int *targets_;
+  const unsigned char *control_;
+  const unsigned char *data_;
+  bool sorted_;
+  int index_;
+  int count_;
+  uint32_t previous_;  //wraps around as the encoded deltas do
+
+};
+
+#endif
@@ -0,0 +1,76 @@
+#include "basic_graph.h"
+#include "graph_external.h"
+#include <cstdlib>
+#include <iostream>
+#include <string>
+using namespace std;
+
+//converts a raw edge list into the binary files of BasicGraph
+//usage: graph_convert [-d] [-l] [-w] [-u] [-c] [-m <MiB> [-t <temp_dir>]] [-v] <edge_list> <base_path>
+//  -d  drop duplicated edges
+//  -l  drop self loops
+//  -w  64-bit edge offsets even for graphs that fit 32-bit ones
+//  -u  undirected graph, stored once as a symmetric OUT view
+//  -c  write the single-file container instead of the .imp_*_bin files
+//  -m  build OUT and IN on disk within the given memory budget,
+//      for edge lists larger than memory
+//  -t  directory of the sorted runs of -m (default .)
+//  -v  verbose
+
+int main(int argc, char **argv){
+  int parameter = 0, save_parameter = kALL;
+  bool verbose = 0;
+  size_t memory_budget = 0;
+  string temp_dir(".");
+  vector<string> paths;
+  for(int i=1; i<argc; i++){
+    string arg(argv[i]);
+    if (arg == "-d")
+      parameter |= kDeduplicate;
+    else
+      if (arg == "-l")
+        parameter |= kNoSelfLoops;
+      else
+        if (arg == "-w")
+          parameter |= kWideOffsets;
+        else
+          if (arg == "-u")
+            parameter |= kUndirected;
+          else
+            if (arg == "-c")
+              save_parameter |= kContainer;
+            else
+              if (arg == "-v")
+                verbose = 1;
+              else
+                if (arg == "-m" && i + 1 < argc)
+                  memory_budget = ( static_cast<size_t>( atol(argv[++i]) ) << 20 );
+                else
+                  if (arg == "-t" && i + 1 < argc)
+                    temp_dir = argv[++i];
+                  else
+                    paths.push_back(arg);
+  }
+  if (paths.size() != 2 || ( memory_budget && ( (save_parameter & kContainer) || (parameter & kUndirected) ) )){
+    cerr << "usage: " << argv[0] << " [-d] [-l] [-w] [-u] [-c] [-m <MiB> [-t <temp_dir>]] [-v] <edge_list> <base_path>" << endl;
+    return 1;
+  }
+
+  try{
+    if (memory_budget){
+      ExternalGraphBuilder builder(temp_dir, memory_budget, parameter, verbose);
+      builder.AddEdgeList(paths[0]);
+      builder.Build(paths[1]);
+      cout << "n = " << builder.GetNumberVertex() << ", e = " << builder.GetNumberEdges() << endl;
+      return 0;
+    }
+    BasicGraph graph(verbose);
+    graph.LoadEdgeList(paths[0], parameter);
+    graph.Save(paths[1], save_parameter);
+    cout << "n = " << graph.GetNumberVertex() << ", e = " << graph.GetNumerEdges() << endl;
+  }catch(std::runtime_error &e){
+    cerr << e.what() << endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,294 @@
+#include "graph_external.h"
+#include "graph_text.h"
+#include "graph_io.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <sstream>
+#include <unistd.h>
+
+const size_t kMinimumBufferEdges = 4096;
+const size_t kTextBlockSize = 16 << 20;
+
+//sequential reader of one sorted run with its own small buffer
+template<class T>
+class RunReader{
+
+ public:
+
+  RunReader(const std::string& path, size_t buffer_size):
+  stream_(path, std::ios::binary), buffer_(buffer_size), position_(0), size_(0){
+    FilePath::CheckForOpen(path, stream_);
+  }
+
+  bool Next(T& value){
+    if (position_ == size_){
+      stream_.read( reinterpret_cast<char*>( &buffer_[0] ), buffer_.size() * sizeof(T) );
+      size_ = stream_.gcount() / sizeof(T);
+      position_ = 0;
+      if (size_ == 0)
+        return 0;
+    }
+    value = buffer_[ position_++ ];
+    return 1;
+  }
+
+ private:
+
+  std::ifstream stream_;
+  std::vector<T> buffer_;
+  size_t position_;
+  size_t size_;
+
+};
+
+//buffered writer of one binary array of ints, or of 64-bit offsets. a failed
+//write throws, the file is dropped unless Close published it
+class IntWriter{
+
+ public:
+
+  IntWriter(const std::string& path, bool overwrite):
+  file_(path, overwrite), offset_(0){
+    buffer_.reserve(kMinimumBufferEdges * 16 * sizeof(int));
+  }
+
+  void Write(int value){
+    Append(&value, sizeof(value));
+  }
+
+  void WriteWide(long long value){
+    Append(&value, sizeof(value));
+  }
+
+  void Flush(){
+    file_.Write(offset_, buffer_.data(), buffer_.size());
+    offset_ += buffer_.size();
+    buffer_.clear();
+  }
+
+  //writes what is left and renames the file over its path
+  void Close(){
+    Flush();
+    file_.Commit();
+  }
+
+ private:
+
+  void Append(const void *value, size_t length){
+    const char *bytes = static_cast<const char*>(value);
+    buffer_.insert(buffer_.end(), bytes, bytes + length);
+    if (buffer_.size() >= buffer_.capacity())
+      Flush();
+  }
+
+  AtomicFile file_;
+  uint64_t offset_;
+  std::vector<char> buffer_;
+
+};
+
+ExternalGraphBuilder::ExternalGraphBuilder(const std::string& temp_dir, size_t memory_budget, const int parameter, bool verbose):
+  temp_dir_(temp_dir), memory_budget_(memory_budget), parameter_(parameter), verbose_(verbose),
+  number_vertex_(0), number_edges_(0), spilled_edges_(0){
+  buffer_capacity_ = std::max(memory_budget_ / sizeof(Edge), kMinimumBufferEdges);
+}
+
+ExternalGraphBuilder::~ExternalGraphBuilder(){
+  RemoveRuns();
+}
+
+void ExternalGraphBuilder::AddEdge(int source, int target){
+  if (source < 0 || target < 0)
+    throw std::runtime_error("Negative vertex id in edge list");
+  if ( (parameter_ & kNoSelfLoops) && source == target )
+    return;
+  number_vertex_ = std::max(number_vertex_, std::max(source, target) + 1);
+  if (buffer_.empty())
+    buffer_.reserve(buffer_capacity_);
+  Edge edge = { source, target };
+  buffer_.push_back(edge);
+  if (buffer_.size() >= buffer_capacity_)
+    Spill();
+}
+
+void ExternalGraphBuilder::AddEdgeList(const std::string& path){
+  std::ifstream stream(path, std::ios::binary);
+  FilePath::CheckForOpen(path, stream);
+  mProcess add_process("Streaming of edge list " + path, 1, verbose_);
+  add_process.Start();
+
+  EdgeListInfo info;
+  std::string block, rest;
+  std::vector<int> sources, targets;
+  bool first_block = 1;
+  while (1){
+    block.resize(kTextBlockSize);
+    stream.read( &block[0], kTextBlockSize );
+    block.resize( stream.gcount() );
+    bool last_block = block.empty();
+    block = rest + block;
+    size_t start = 0;
+    if (first_block && TextParser::IsMatrixMarket(block.data(), block.size())){
+      start = TextParser::ParseMatrixMarketHeader(block.data(), block.size(), path, info);
+      if (info.number_vertex > std::numeric_limits<int>::max())
+        throw std::runtime_error("Vertex id out of range in " + path);
+      number_vertex_ = std::max(number_vertex_, static_cast<int>(info.number_vertex));
+    }
+    first_block = 0;
+    //only whole lines are parsed, the tail waits for the next block
+    size_t end = block.size();
+    if (!last_block)
+      end = block.rfind('\n') == std::string::npos ? start : block.rfind('\n') + 1;
+    const char *begin = block.data() + start;
+    long long count = TextParser::ParseEdgeLines<int>(begin, block.data() + end, 0, 0);
+    sources.resize(count);
+    targets.resize(count);
+    TextParser::ParseEdgeLines(begin, block.data() + end, sources.data(), targets.data());
+    int shift = info.one_based ? 1 : 0;
+    for(long long i = 0; i < count; i++){
+      AddEdge(sources[i] - shift, targets[i] - shift);
+      if (info.symmetric && sources[i] != targets[i])
+        AddEdge(targets[i] - shift, sources[i] - shift);
+    }
+    rest = block.substr(end);
+    if (last_block)
+      break;
+  }
+  add_process.Stop();
+}
+
+void ExternalGraphBuilder::Spill(){
+  if (buffer_.empty())
+    return;
+  mProcess spill_process("Spill of " + std::to_string(buffer_.size()) + " edges", 1, verbose_);
+  spill_process.Start();
+  std::ostringstream prefix;
+  prefix << temp_dir_ << "/hk_run_" << getpid() << "_" << this << "_" << out_runs_.size();
+
+  std::sort(buffer_.begin(), buffer_.end());
+  if (parameter_ & kDeduplicate)
+    buffer_.erase( std::unique(buffer_.begin(), buffer_.end()), buffer_.end() );
+  spilled_edges_ += buffer_.size();
+  out_runs_.push_back(prefix.str() + ".out");
+  WriteRun(out_runs_.back());
+
+  for(auto &edge: buffer_)
+    std::swap(edge.first, edge.second);
+  std::sort(buffer_.begin(), buffer_.end());
+  in_runs_.push_back(prefix.str() + ".in");
+  WriteRun(in_runs_.back());
+
+  buffer_.clear();
+  spill_process.Stop();
+}
+
+void ExternalGraphBuilder::WriteRun(const std::string& path) const{
+  std::ofstream stream(path, std::ios::binary);
+  FilePath::CheckForCreation(path, stream);
+  stream.write( reinterpret_cast<const char*>( buffer_.data() ), buffer_.size() * sizeof(Edge) );
+  //a run is read back before it is removed, the buffered tail must be on disk
+  stream.close();
+  if (!stream)
+    throw std::runtime_error("Failed to write " + path);
+}
+
+long long ExternalGraphBuilder::Merge(const std::vector<std::string>& runs, const std::string& base_name){
+  mProcess merge_process("Merge of " + std::to_string(runs.size()) + " runs into " + base_name, number_vertex_, verbose_, 1 << 20);
+  merge_process.Start();
+  //the budget is shared by one read buffer per run and the two writers
+  size_t run_buffer = std::max( memory_budget_ / ( runs.size() + 1 ) / sizeof(Edge), kMinimumBufferEdges );
+  std::vector< std::unique_ptr< RunReader<Edge> > > readers;
+  typedef std::pair<Edge, int> Head;
+  auto greater = [](const Head& a, const Head& b){ return b.first < a.first; };
+  std::priority_queue<Head, std::vector<Head>, decltype(greater)> heads(greater);
+  for(size_t i = 0; i < runs.size(); i++){
+    readers.push_back( std::unique_ptr< RunReader<Edge> >( new RunReader<Edge>(runs[i], run_buffer) ) );
+    Edge edge;
+    if (readers[i]->Next(edge))
+      heads.push( Head(edge, i) );
+  }
+
+  //the merge may drop duplicates, the offsets are sized for the edges spilled
+  bool wide = (parameter_ & kWideOffsets) || EdgeOffsets::NeedsWide(spilled_edges_);
+  bool overwrite = parameter_ & kOverwrite;
+  IntWriter index_writer(base_name + ".ind", overwrite);
+  IntWriter bound_writer(base_name + ".bou", overwrite);
+  IntWriter target_writer(base_name + ".tar", overwrite);
+  long long count = 0;
+  {
+    int vertex = 0;
+    bool any = 0;
+    Edge last = { 0, 0 };
+    while (!heads.empty()){
+      Head head = heads.top();
+      heads.pop();
+      Edge edge;
+      if (readers[head.second]->Next(edge))
+        heads.push( Head(edge, head.second) );
+      if ( (parameter_ & kDeduplicate) && any && head.first == last )
+        continue;
+      for(; vertex < head.first.first; vertex++){
+        if (wide)
+          bound_writer.WriteWide(count);
+        else
+          bound_writer.Write(count);
+        merge_process.Update(vertex);
+      }
+      target_writer.Write(head.first.second);
+      count++;
+      last = head.first;
+      any = 1;
+    }
+    for(; vertex < number_vertex_; vertex++)
+      if (wide)
+        bound_writer.WriteWide(count);
+      else
+        bound_writer.Write(count);
+  }
+  readers.clear();
+
+  index_writer.Write(number_vertex_);
+  if (wide){
+    index_writer.Write(kWideEdgeCount);
+    index_writer.WriteWide(count);
+  }else{
+    index_writer.Write(count);
+  }
+  //the runs are merged in order, every list comes out sorted
+  index_writer.Write(kSectionSorted);
+  //a reader that finds the index finds the arrays too
+  target_writer.Close();
+  bound_writer.Close();
+  index_writer.Close();
+  merge_process.Stop();
+  return count;
+}
+
+void ExternalGraphBuilder::Build(const std::string& base_path){
+  AtomicFile index_file(base_path + ".ind", parameter_ & kOverwrite);
+  Spill();
+  std::vector<Edge>().swap(buffer_);
+
+  number_edges_ = Merge(out_runs_, base_path + ".imp_" + CONVERT_TO_STRING(OUT) + "_bin");
+  Merge(in_runs_, base_path + ".imp_" + CONVERT_TO_STRING(IN) + "_bin");
+  RemoveRuns();
+
+  //the index is published last, Load starts from it
+  std::ostringstream index_stream;
+  index_stream << number_vertex_ << "\n" << number_edges_ << "\n" << 0 << "\n";
+  index_file.Write(0, index_stream.str().data(), index_stream.str().size());
+  index_file.Commit();
+}
+
+void ExternalGraphBuilder::RemoveRuns(){
+  for(auto &run: out_runs_)
+    remove(run.c_str());
+  for(auto &run: in_runs_)
+    remove(run.c_str());
+  out_runs_.clear();
+  in_runs_.clear();
+}
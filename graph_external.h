@@ -0,0 +1,69 @@
+#ifndef GRAPH_EXTERNAL_
+#define GRAPH_EXTERNAL_
+
+#include "utility.h"
+#include "basic_graph.h"
+#include <string>
+#include <vector>
+
+//builds the OUT and IN binary files of a graph that does not fit in memory.
+//edges are buffered up to the memory budget, every full buffer is sorted and
+//spilled to two runs under temp_dir (one by source, one by target), and Build
+//k-way merges the runs straight into the .imp_out_bin / .imp_in_bin files.
+//only the buffer and one read buffer per run are ever held in memory.
+class ExternalGraphBuilder{
+
+ public:
+
+  //parameter accepts kDeduplicate, kNoSelfLoops and kWideOffsets, the offsets
+  //are 64-bit anyway once more edges than an int holds were added. every file
+  //is published by an atomic rename as with Save, kOverwrite replaces old ones
+  ExternalGraphBuilder(const std::string& temp_dir, size_t memory_budget, const int parameter = 0, bool verbose = 0);
+  ~ExternalGraphBuilder();
+
+  void AddEdge(int source, int target);
+  //streams a plain, SNAP or Matrix Market edge list without mapping it whole
+  void AddEdgeList(const std::string& path);
+
+  //writes the OUT and IN binary views and then <base_path>.ind, and drops the
+  //runs. nothing is published under base_path when it throws
+  void Build(const std::string& base_path);
+
+  int GetNumberVertex() const { return number_vertex_; }
+  long long GetNumberEdges() const { return number_edges_; }
+
+ private:
+
+  struct Edge{
+    int first;
+    int second;
+    bool operator<(const Edge& other) const {
+      return first < other.first || ( first == other.first && second < other.second );
+    }
+    bool operator==(const Edge& other) const {
+      return first == other.first && second == other.second;
+    }
+  };
+
+  void Spill();
+  void WriteRun(const std::string& path) const;
+  long long Merge(const std::vector<std::string>& runs, const std::string& base_name);
+  void RemoveRuns();
+
+  std::string temp_dir_;
+  size_t memory_budget_;
+  int parameter_;
+  bool verbose_;
+
+  std::vector<Edge> buffer_;
+  size_t buffer_capacity_;
+  std::vector<std::string> out_runs_;
+  std::vector<std::string> in_runs_;
+
+  int number_vertex_;
+  long long number_edges_;
+  long long spilled_edges_;
+
+};
+
+#endif
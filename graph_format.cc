@@ -0,0 +1,54 @@
+#include "graph_format.h"
+#include <cstring>
+
+const uint64_t kChecksumSeed = 0x9e3779b97f4a7c15ULL;
+const uint64_t kChecksumPrime = 0x100000001b3ULL;
+
+uint64_t GraphFormat::Checksum(const void *data, size_t length){
+  const unsigned char *bytes = static_cast<const unsigned char*>(data);
+  uint64_t hash = kChecksumSeed ^ length;
+  size_t i = 0;
+  for(; i + 8 <= length; i += 8){
+    uint64_t word;
+    memcpy(&word, bytes + i, 8);
+    hash = ( hash ^ word ) * kChecksumPrime;
+    hash ^= hash >> 29;
+  }
+  for(; i < length; i++)
+    hash = ( hash ^ bytes[i] ) * kChecksumPrime;
+  return hash ^ ( hash >> 32 );
+}
+
+void GraphFormat::InitHeader(GraphFileHeader& header){
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, kGraphMagic, sizeof(kGraphMagic));
+  header.version = kGraphFormatVersion;
+  header.vertex_size = sizeof(int);
+}
+
+void GraphFormat::CheckHeader(const GraphFileHeader& header, uint64_t file_length, const std::string& path){
+  if (file_length < sizeof(GraphFileHeader) || memcmp(header.magic, kGraphMagic, sizeof(kGraphMagic)) != 0)
+    throw std::runtime_error("Not a graph container: " + path);
+  if (header.version != kGraphFormatVersion)
+    throw std::runtime_error("Unsupported container version in " + path);
+  if (header.vertex_size != 0 && header.vertex_size != sizeof(int))
+    throw std::runtime_error("Unsupported vertex id width in " + path);
+  if (header.number_sections > static_cast<uint32_t>(kMaxSections) ||
+      sizeof(GraphFileHeader) + header.number_sections * sizeof(GraphSection) > file_length)
+    throw std::runtime_error("Corrupted section table in " + path);
+}
+
+void GraphFormat::CheckSection(const GraphSection& section, uint64_t file_length, const std::string& path){
+  bool wide_boundaries = section.kind == kBoundarySection && section.element_size == sizeof(long long);
+  if (section.kind >= kSectionKinds || ( section.element_size != ElementSize(section.kind) && !wide_boundaries ))
+    throw std::runtime_error("Unknown section in " + path);
+  if (section.offset % kSectionAlignment != 0 ||
+      section.offset > file_length || section.length > file_length - section.offset ||
+      section.length % section.element_size != 0 || section.length / section.element_size != section.count)
+    throw std::runtime_error("Corrupted section in " + path);
+}
+
+void GraphFormat::CheckChecksum(const GraphSection& section, const void *data, const std::string& path){
+  if (Checksum(data, section.length) != section.checksum)
+    throw std::runtime_error("Checksum mismatch in " + path);
+}
@@ -0,0 +1,95 @@
+#ifndef GRAPH_FORMAT_
+#define GRAPH_FORMAT_
+
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+//layout of the single-file container <base_path>.graph:
+//
+//  [GraphFileHeader][GraphSection x number_sections][padding]
+//  [section 0][padding][section 1][padding]...
+//
+//every section starts on a kSectionAlignment boundary so that it can be
+//used in place once the file is mapped. all integers are little endian.
+//boundary sections hold 32-bit or 64-bit offsets, as their element_size says,
+//vertex ids are as wide as header.vertex_size, raw ids are always 64-bit.
+
+static const char kContainerSuffix[] = ".graph";
+static const char kGraphMagic[8] = { 'H', 'K', 'G', 'R', 'A', 'P', 'H', '\0' };
+const uint32_t kGraphFormatVersion = 1;
+const uint64_t kSectionAlignment = 4096;
+const int kMaxSections = 32;
+
+enum SectionKind{
+  kBoundarySection,    //int or long long edge offsets
+  kTargetSection,
+  kOffsetSection,      //byte offsets of the lists of a compressed view
+  kCompressedSection,  //StreamVByte encoded targets of a compressed view
+  kMappingSection,     //raw id of every vertex, view is BAD as it belongs to none
+  kIdIndexSection,     //IdIndex table from the raw ids back to the vertices, view is BAD
+  kSectionKinds
+};
+
+//GraphFileHeader::flags
+const uint32_t kGraphUndirected = 1 << 0;
+
+//GraphSection::flags
+const uint32_t kSectionSorted = 1 << 0;
+
+struct GraphFileHeader{
+  char magic[8];
+  uint32_t version;
+  uint32_t flags;
+  uint64_t number_vertex;
+  uint64_t number_edges;
+  uint32_t number_sections;
+  uint32_t vertex_size;  //bytes per vertex id, 0 in files that predate it means 4
+};
+
+struct GraphSection{
+  uint32_t view;  //GraphType
+  uint32_t kind;  //SectionKind
+  uint32_t flags;
+  uint32_t element_size;
+  uint64_t count;
+  uint64_t offset;
+  uint64_t length;
+  uint64_t checksum;
+};
+
+class GraphFormat{
+
+ public:
+
+  static uint64_t Align(uint64_t offset){
+    return ( offset + kSectionAlignment - 1 ) / kSectionAlignment * kSectionAlignment;
+  }
+
+  //64-bit checksum consuming eight bytes per step
+  static uint64_t Checksum(const void *data, size_t length);
+
+  //the default width of a section, boundaries may be 64-bit as well
+  static uint32_t ElementSize(uint32_t kind){
+    switch (kind){
+    case kOffsetSection:
+    case kMappingSection:
+      return sizeof(uint64_t);
+    case kIdIndexSection:
+      return 2 * sizeof(uint64_t);
+    case kCompressedSection:
+      return 1;
+    default:
+      return sizeof(int);
+    }
+  }
+
+  static void InitHeader(GraphFileHeader& header);
+  static void CheckHeader(const GraphFileHeader& header, uint64_t file_length, const std::string& path);
+  static void CheckSection(const GraphSection& section, uint64_t file_length, const std::string& path);
+  static void CheckChecksum(const GraphSection& section, const void *data, const std::string& path);
+
+};
+
+#endif
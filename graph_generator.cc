@@ -0,0 +1,275 @@
+#include "graph_generator.h"
+#include "graph_random.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+//the upper half of every Philox counter tells the streams of a seed apart
+const uint64_t kEdgeStream = 0;
+const uint64_t kNoiseStream = 1ULL << 32;
+const uint64_t kPermutationStream = 2ULL << 32;
+const uint64_t kErdosRenyiStream = 3ULL << 32;
+const uint64_t kBarabasiAlbertStream = 4ULL << 32;
+const uint64_t kWattsStrogatzStream = 5ULL << 32;
+const uint64_t kStochasticBlockStream = 6ULL << 32;
+
+//slots of a skip sampling task, about this many edges are expected in one
+const double kExpectedTaskEdges = 1 << 20;
+
+//runs generate(task, sources, targets) for every task on all threads and
+//concatenates the edges in task order, so the result does not depend on the threads
+template<class F>
+static void GenerateTasks(long long tasks, F generate, std::vector<int>& sources, std::vector<int>& targets){
+  std::vector< std::vector<int> > task_sources(tasks), task_targets(tasks);
+  mParallel::For(0, tasks, [&](int thread_id, long long begin, long long end){
+      for(long long i = begin; i < end; i++)
+        generate(i, task_sources[i], task_targets[i]);
+    });
+  std::vector<long long> offsets(tasks + 1, 0);
+  for(long long i = 0; i < tasks; i++)
+    offsets[i+1] = offsets[i] + task_sources[i].size();
+  sources.resize(offsets[tasks]);
+  targets.resize(offsets[tasks]);
+  mParallel::For(0, tasks, [&](int thread_id, long long begin, long long end){
+      for(long long i = begin; i < end; i++){
+        std::copy(task_sources[i].begin(), task_sources[i].end(), sources.begin() + offsets[i]);
+        std::copy(task_targets[i].begin(), task_targets[i].end(), targets.begin() + offsets[i]);
+        std::vector<int>().swap(task_sources[i]);
+        std::vector<int>().swap(task_targets[i]);
+      }
+    });
+}
+
+//every slot of [0, slots) is picked with probability probability, the gaps
+//between picks are geometric. the slots are cut in tasks of a fixed size that
+//depends on the probability only, each drawing from its own stream
+template<class F>
+static void SkipSample(uint64_t slots, double probability, uint64_t seed, uint64_t stream, F emit,
+                       std::vector<int>& sources, std::vector<int>& targets){
+  if (probability <= 0 || slots == 0)
+    return;
+  uint64_t task_slots = static_cast<uint64_t>( std::max(kExpectedTaskEdges, kExpectedTaskEdges / probability) );
+  long long tasks = ( slots + task_slots - 1 ) / task_slots;
+  double log_miss = std::log1p(-probability);
+  GenerateTasks(tasks, [&](long long task, std::vector<int>& task_sources, std::vector<int>& task_targets){
+      RandomStream random(seed, stream + task);
+      uint64_t end = std::min<uint64_t>( slots, ( task + 1 ) * task_slots );
+      for(uint64_t slot = task * task_slots; ; slot++){
+        if (probability < 1){
+          double skip = std::floor( std::log( 1 - random.Uniform() ) / log_miss );
+          if (skip >= end - slot)
+            break;
+          slot += static_cast<uint64_t>(skip);
+        }
+        if (slot >= end)
+          break;
+        emit(slot, task_sources, task_targets);
+      }
+    }, sources, targets);
+}
+
+static void AddUndirected(int u, int v, std::vector<int>& sources, std::vector<int>& targets){
+  sources.push_back(u);
+  targets.push_back(v);
+  sources.push_back(v);
+  targets.push_back(u);
+}
+
+void GraphGenerator::RMAT(const RMATOptions& options, std::vector<int>& sources, std::vector<int>& targets){
+  int scale = options.scale;
+  double a = options.a, b = options.b, c = options.c, d = 1 - a - b - c;
+  if (scale < 1 || scale > 30)
+    throw std::runtime_error("RMAT scale out of range");
+  if (a < 0 || b < 0 || c < 0 || d < 0 || options.edge_factor < 0)
+    throw std::runtime_error("Invalid RMAT parameters");
+  if (options.noise < 0 || options.noise > std::min( std::min(b, c), ( a + d ) / 2 ))
+    throw std::runtime_error("RMAT noise must keep every probability positive");
+
+  //cumulative probabilities of the quadrants, the noise moves mass between
+  //the diagonal and the off-diagonal quadrants level by level
+  std::vector<double> thresholds(3 * scale);
+  for(int level = 0; level < scale; level++){
+    uint32_t words[4];
+    Philox::Generate(options.seed, level, kNoiseStream, words);
+    double mu = options.noise * ( 2 * Philox::Uniform(words[0]) - 1 );
+    double a_level = a - 2 * mu * a / ( a + d );
+    thresholds[ 3 * level ] = a_level;
+    thresholds[ 3 * level + 1 ] = a_level + b + mu;
+    thresholds[ 3 * level + 2 ] = a_level + b + c + 2 * mu;
+  }
+  std::vector<int> permutation;
+  if (options.permute)
+    permutation = Permutation(1 << scale, options.seed);
+
+  long long number_edges = std::llround( options.edge_factor * ( 1 << scale ) );
+  sources.resize(number_edges);
+  targets.resize(number_edges);
+  //edge i draws its levels from the counters (i, 0), (i, 1)... four at a time
+  mParallel::For(0, number_edges, [&](int thread_id, long long begin, long long end){
+      uint32_t words[4];
+      for(long long i = begin; i < end; i++){
+        int source = 0, target = 0;
+        for(int level = 0; level < scale; level++){
+          if ( ( level & 3 ) == 0 )
+            Philox::Generate(options.seed, i, kEdgeStream | ( level >> 2 ), words);
+          double u = Philox::Uniform( words[ level & 3 ] );
+          int bit = 1 << ( scale - 1 - level );
+          const double *threshold = &thresholds[ 3 * level ];
+          if (u >= threshold[0]){
+            if (u < threshold[1]){
+              target |= bit;
+            }else{
+              source |= bit;
+              if (u >= threshold[2])
+                target |= bit;
+            }
+          }
+        }
+        sources[i] = options.permute ? permutation[source] : source;
+        targets[i] = options.permute ? permutation[target] : target;
+      }
+    });
+}
+
+std::vector<int> GraphGenerator::Permutation(int size, uint64_t seed){
+  std::vector<int> permutation(size);
+  for(int i = 0; i < size; i++)
+    permutation[i] = i;
+  //Fisher-Yates, the swap partner of i comes from counter i
+  uint32_t words[4];
+  for(int i = size - 1; i > 0; i--){
+    Philox::Generate(seed, i, kPermutationStream, words);
+    int j = ( static_cast<uint64_t>(words[0]) * ( i + 1 ) ) >> 32;
+    std::swap(permutation[i], permutation[j]);
+  }
+  return permutation;
+}
+
+void GraphGenerator::ErdosRenyi(int number_vertex, long long number_edges, uint64_t seed,
+                                std::vector<int>& sources, std::vector<int>& targets){
+  sources.clear();
+  targets.clear();
+  if (number_vertex < 2 || number_edges <= 0)
+    return;
+  //the n*n square is sampled and its diagonal dropped
+  uint64_t n = number_vertex;
+  double probability = std::min( 1.0, number_edges / ( static_cast<double>(n) * ( n - 1 ) ) );
+  SkipSample(n * n, probability, seed, kErdosRenyiStream,
+             [&](uint64_t slot, std::vector<int>& task_sources, std::vector<int>& task_targets){
+               int u = slot / n, v = slot % n;
+               if (u != v){
+                 task_sources.push_back(u);
+                 task_targets.push_back(v);
+               }
+             }, sources, targets);
+}
+
+void GraphGenerator::BarabasiAlbert(int number_vertex, int edges_per_vertex, uint64_t seed,
+                                    std::vector<int>& sources, std::vector<int>& targets){
+  if (number_vertex < 0 || edges_per_vertex < 0)
+    throw std::runtime_error("Invalid Barabasi-Albert parameters");
+  //edge e leaves e / edges_per_vertex and copies the endpoint r of the list
+  //[source 0, target 0, source 1, target 1...] drawn uniformly among the 2e+1
+  //first ones. an odd r is the target of an earlier edge, drawn the same way
+  long long number_edges = static_cast<long long>(number_vertex) * edges_per_vertex;
+  sources.resize(2 * number_edges);
+  targets.resize(2 * number_edges);
+  mParallel::For(0, number_edges, [&](int thread_id, long long begin, long long end){
+      for(long long e = begin; e < end; e++){
+        long long r = 2 * e + 1;
+        do{
+          long long edge = r / 2;
+          uint32_t words[4];
+          Philox::Generate(seed, edge, kBarabasiAlbertStream, words);
+          uint64_t word = ( static_cast<uint64_t>(words[0]) << 32 ) | words[1];
+          r = static_cast<long long>( ( static_cast<unsigned __int128>(word) * ( 2 * edge + 1 ) ) >> 64 );
+        }while (r & 1);
+        int source = e / edges_per_vertex, target = ( r / 2 ) / edges_per_vertex;
+        sources[ 2 * e ] = source;
+        targets[ 2 * e ] = target;
+        sources[ 2 * e + 1 ] = target;
+        targets[ 2 * e + 1 ] = source;
+      }
+    });
+}
+
+void GraphGenerator::WattsStrogatz(int number_vertex, int degree, double rewiring, uint64_t seed,
+                                   std::vector<int>& sources, std::vector<int>& targets){
+  if (number_vertex < 0 || degree < 0 || degree >= number_vertex || rewiring < 0 || rewiring > 1)
+    throw std::runtime_error("Invalid Watts-Strogatz parameters");
+  int half = degree / 2;
+  long long number_edges = static_cast<long long>(number_vertex) * half;
+  sources.resize(2 * number_edges);
+  targets.resize(2 * number_edges);
+  mParallel::For(0, number_vertex, [&](int thread_id, long long begin, long long end){
+      for(long long i = begin; i < end; i++){
+        RandomStream random(seed, kWattsStrogatzStream + i);
+        for(int j = 1; j <= half; j++){
+          int target = ( i + j ) % number_vertex;
+          if (random.Uniform() < rewiring)
+            do
+              target = random.Below(number_vertex);
+            while (target == i);
+          long long e = i * half + j - 1;
+          sources[ 2 * e ] = i;
+          targets[ 2 * e ] = target;
+          sources[ 2 * e + 1 ] = target;
+          targets[ 2 * e + 1 ] = i;
+        }
+      }
+    });
+}
+
+void GraphGenerator::Grid(int x, int y, int z, bool torus, std::vector<int>& sources, std::vector<int>& targets){
+  if (x < 1 || y < 1 || z < 1 || static_cast<long long>(x) * y * z > std::numeric_limits<int>::max())
+    throw std::runtime_error("Invalid grid dimensions");
+  int sizes[3] = { x, y, z };
+  //one task per row along x, a vertex links to its successor in every dimension
+  GenerateTasks(static_cast<long long>(y) * z, [&](long long row, std::vector<int>& task_sources, std::vector<int>& task_targets){
+      int coordinates[3] = { 0, static_cast<int>( row % y ), static_cast<int>( row / y ) };
+      for(coordinates[0] = 0; coordinates[0] < x; coordinates[0]++){
+        int u = ( coordinates[2] * y + coordinates[1] ) * x + coordinates[0];
+        for(int d = 0, stride = 1; d < 3; stride *= sizes[d++]){
+          if (coordinates[d] + 1 < sizes[d])
+            AddUndirected(u, u + stride, task_sources, task_targets);
+          else
+            if (torus && sizes[d] > 2)
+              AddUndirected(u, u - ( sizes[d] - 1 ) * stride, task_sources, task_targets);
+        }
+      }
+    }, sources, targets);
+}
+
+void GraphGenerator::StochasticBlock(const std::vector<int>& block_sizes, const std::vector<double>& probabilities, uint64_t seed,
+                                     std::vector<int>& sources, std::vector<int>& targets){
+  size_t blocks = block_sizes.size();
+  if (probabilities.size() != blocks * blocks)
+    throw std::runtime_error("Stochastic block model needs blocks * blocks probabilities");
+  std::vector<int> first(blocks + 1, 0);
+  for(size_t a = 0; a < blocks; a++){
+    if (block_sizes[a] < 0 || first[a] + static_cast<long long>(block_sizes[a]) > std::numeric_limits<int>::max())
+      throw std::runtime_error("Invalid block sizes");
+    first[a+1] = first[a] + block_sizes[a];
+  }
+  sources.clear();
+  targets.clear();
+  //every pair of blocks is skip sampled on its own stream range, the pairs
+  //inside a block are taken from the square with u < v
+  std::vector<int> pair_sources, pair_targets;
+  for(size_t a = 0; a < blocks; a++)
+    for(size_t b = a; b < blocks; b++){
+      uint64_t size_b = block_sizes[b];
+      uint64_t stream = kStochasticBlockStream + ( ( a * blocks + b ) << 20 );
+      pair_sources.clear();
+      pair_targets.clear();
+      SkipSample(static_cast<uint64_t>(block_sizes[a]) * size_b, probabilities[ a * blocks + b ], seed, stream,
+                 [&](uint64_t slot, std::vector<int>& task_sources, std::vector<int>& task_targets){
+                   int u = slot / size_b, v = slot % size_b;
+                   if (a != b || u < v)
+                     AddUndirected(first[a] + u, first[b] + v, task_sources, task_targets);
+                 }, pair_sources, pair_targets);
+      sources.insert(sources.end(), pair_sources.begin(), pair_sources.end());
+      targets.insert(targets.end(), pair_targets.begin(), pair_targets.end());
+    }
+}
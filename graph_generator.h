@@ -0,0 +1,58 @@
+#ifndef GRAPH_GENERATOR_
+#define GRAPH_GENERATOR_
+
+#include "utility.h"
+#include <cstdint>
+#include <vector>
+
+//Graph500 Kronecker (RMAT) parameters
+struct RMATOptions{
+
+RMATOptions(): scale(10), edge_factor(16), a(0.57), b(0.19), c(0.19), noise(0), seed(1), permute(1){}
+
+  int scale;           //2^scale vertices
+  double edge_factor;  //edges drawn per vertex, before duplicates are dropped
+  double a, b, c;      //quadrant probabilities, d is what remains
+  double noise;        //per level perturbation of the probabilities as in noisy SKG, 0 for none
+  uint64_t seed;
+  bool permute;        //scramble the vertex ids
+
+};
+
+//synthetic edge lists drawn from counter-based random streams: the list of a
+//seed is the same on every machine whatever the number of threads
+class GraphGenerator{
+
+ public:
+
+  static void RMAT(const RMATOptions& options, std::vector<int>& sources, std::vector<int>& targets);
+
+  //directed G(n,p) with p chosen for number_edges edges on average, sampled by
+  //geometric skips over the n*(n-1) possible edges
+  static void ErdosRenyi(int number_vertex, long long number_edges, uint64_t seed,
+                         std::vector<int>& sources, std::vector<int>& targets);
+
+  //the generators below are undirected, every edge comes out in both directions
+
+  //preferential attachment, every vertex links edges_per_vertex times to the
+  //endpoint of an earlier edge drawn uniformly (the Batagelj-Brandes copy
+  //model). the draws are resolved edge by edge, so it runs in parallel
+  static void BarabasiAlbert(int number_vertex, int edges_per_vertex, uint64_t seed,
+                             std::vector<int>& sources, std::vector<int>& targets);
+  //ring lattice of degree degree (rounded down to even) whose edges are
+  //rewired to a uniform vertex with probability rewiring
+  static void WattsStrogatz(int number_vertex, int degree, double rewiring, uint64_t seed,
+                            std::vector<int>& sources, std::vector<int>& targets);
+  //x * y * z lattice, the torus wraps every dimension longer than 2
+  static void Grid(int x, int y, int z, bool torus, std::vector<int>& sources, std::vector<int>& targets);
+  //stochastic block model, vertices are numbered block by block and two
+  //vertices of blocks a and b are linked with probability probabilities[a * blocks + b]
+  static void StochasticBlock(const std::vector<int>& block_sizes, const std::vector<double>& probabilities, uint64_t seed,
+                              std::vector<int>& sources, std::vector<int>& targets);
+
+  //a uniform random permutation of 0..size-1
+  static std::vector<int> Permutation(int size, uint64_t seed);
+
+};
+
+#endif
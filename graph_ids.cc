@@ -0,0 +1,68 @@
+#include "graph_ids.h"
+#include <algorithm>
+
+bool IdIndex::Build(const long long *raw_ids, int size, IdSlot *slots){
+  uint64_t capacity = Capacity(size);
+  mParallel::For(0, capacity, [&](int thread_id, long long begin, long long end){
+      for(long long s = begin; s < end; s++){
+        slots[s].raw = 0;
+        slots[s].id = -1;
+        slots[s].reserved = 0;
+      }
+    });
+  IdIndex index;
+  index.Bind(slots, capacity);
+  //a slot is claimed by its id, its raw id is only read once every thread is done
+  mParallel::For(0, size, [&](int thread_id, long long begin, long long end){
+      for(long long i = begin; i < end; i++)
+        for(uint64_t s = index.Home(raw_ids[i]); ; s = ( s + 1 ) & index.mask_){
+          int empty = -1;
+          if (__atomic_compare_exchange_n(&slots[s].id, &empty, static_cast<int>(i), false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)){
+            slots[s].raw = raw_ids[i];
+            break;
+          }
+        }
+    });
+  //a repeated raw id is found at the first of its slots only
+  std::vector<char> valid(mParallel::Threads(), 1);
+  mParallel::For(0, size, [&](int thread_id, long long begin, long long end){
+      for(long long i = begin; i < end; i++)
+        if (index.Find(raw_ids[i]) != i)
+          valid[thread_id] = 0;
+    });
+  return std::find(valid.begin(), valid.end(), 0) == valid.end();
+}
+
+std::vector<long long> IdIndex::Unique(std::vector<long long> sorted){
+  long long size = sorted.size();
+  //blocks sorted side by side, then merged pairwise, half as many blocks every round
+  int blocks = mParallel::Threads();
+  std::vector<long long> bounds(blocks + 1);
+  for(int i = 0; i <= blocks; i++)
+    bounds[i] = size * i / blocks;
+  mParallel::Run(blocks, [&](int thread_id){
+      std::sort(sorted.begin() + bounds[thread_id], sorted.begin() + bounds[thread_id + 1]);
+    });
+  for(int width = 1; width < blocks; width *= 2){
+    int pairs = ( blocks + 2 * width - 1 ) / ( 2 * width );
+    mParallel::Run(pairs, [&](int pair){
+        int first = 2 * width * pair;
+        int middle = std::min(first + width, blocks), last = std::min(first + 2 * width, blocks);
+        std::inplace_merge(sorted.begin() + bounds[first], sorted.begin() + bounds[middle], sorted.begin() + bounds[last]);
+      });
+  }
+  sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+  return sorted;
+}
+
+void IdIndex::FindAll(const long long *raw_ids, long long size, int *ids) const {
+  mParallel::For(0, size, [&](int thread_id, long long begin, long long end){
+      for(long long i = begin; i < end && i < begin + kPrefetchDistance; i++)
+        __builtin_prefetch( slots_ + Home(raw_ids[i]) );
+      for(long long i = begin; i < end; i++){
+        if (i + kPrefetchDistance < end)
+          __builtin_prefetch( slots_ + Home(raw_ids[i + kPrefetchDistance]) );
+        ids[i] = Find(raw_ids[i]);
+      }
+    }, BatchThreads(size));
+}
@@ -0,0 +1,93 @@
+#ifndef GRAPH_IDS_
+#define GRAPH_IDS_
+
+#include "utility.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+//one entry of an IdIndex, id is -1 in an empty slot
+struct IdSlot{
+  long long raw;
+  int id;
+  int reserved;
+};
+
+//index from 64-bit raw ids to vertex ids: open addressing with linear probing
+//over a power of two table at most half full. the table is one flat array so
+//that it can be saved and used in place from a mapped file
+class IdIndex{
+
+ public:
+
+  IdIndex(): slots_(0), mask_(0), shift_(64){}
+
+  //batches are read this many ids ahead
+  static const int kPrefetchDistance = 16;
+  //a batch is split over threads only when every one gets this many ids
+  static const long long kIdsPerThread = 1 << 16;
+
+  //slots of the table over size raw ids
+  static uint64_t Capacity(long long size){
+    uint64_t capacity = 2;
+    while (capacity < 2 * static_cast<uint64_t>(size))
+      capacity *= 2;
+    return capacity;
+  }
+
+  //fills slots, Capacity(size) of them, with raw_ids[i] -> i in parallel,
+  //false when a raw id is repeated
+  static bool Build(const long long *raw_ids, int size, IdSlot *slots);
+
+  //the distinct values of ids in increasing order
+  static std::vector<long long> Unique(std::vector<long long> ids);
+
+  void Bind(const IdSlot *slots, uint64_t capacity){
+    slots_ = slots;
+    mask_ = capacity ? capacity - 1 : 0;
+    shift_ = 64;
+    for(uint64_t c = capacity; c > 1; c /= 2)
+      shift_--;
+  }
+  bool IsBound() const { return slots_ != 0; }
+  const IdSlot* Slots() const { return slots_; }
+
+  //threads worth starting for a batch of size ids, small batches stay on the caller
+  static int BatchThreads(long long size){
+    return std::max<long long>( 1, std::min<long long>( mParallel::Threads(), size / kIdsPerThread ) );
+  }
+
+  //the id of raw_id, -1 when it is not one
+  int Find(long long raw_id) const {
+    for(uint64_t s = Home(raw_id); ; s = ( s + 1 ) & mask_){
+      const IdSlot &slot = slots_[s];
+      if (slot.id < 0 || slot.raw == raw_id)
+        return slot.id;
+    }
+  }
+
+  //ids[i] = Find(raw_ids[i]), large batches in parallel. the slot of the key
+  //kPrefetchDistance ahead is requested while the current one is probed
+  void FindAll(const long long *raw_ids, long long size, int *ids) const;
+
+ private:
+
+  static uint64_t Mix(long long raw_id){
+    uint64_t x = static_cast<uint64_t>(raw_id);
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDULL;
+    x ^= x >> 33;
+    return x;
+  }
+  uint64_t Home(long long raw_id) const {
+    //the high bits are the best mixed ones
+    return shift_ < 64 ? ( Mix(raw_id) * 0x9E3779B97F4A7C15ULL ) >> shift_ : 0;
+  }
+
+  const IdSlot *slots_;
+  uint64_t mask_;
+  int shift_;
+
+};
+
+#endif
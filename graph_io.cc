@@ -0,0 +1,106 @@
+#include "graph_io.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <fcntl.h>
+#include <unistd.h>
+
+const size_t kMinimumParallelWrite = 4 << 20;
+
+//the temporary names of one process, two threads saving the same path get two of them
+static std::atomic<unsigned long long> temp_counter(0);
+
+static const char kDigitPairs[] =
+  "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+  "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+
+AtomicFile::AtomicFile(const std::string& path, bool overwrite):
+  path_(path), fd_(-1){
+  if (!overwrite)
+    FilePath::CheckForExistence(path);
+  std::ostringstream temp_path;
+  temp_path << path << ".tmp." << getpid() << "." << temp_counter++;
+  temp_path_ = temp_path.str();
+  fd_ = open(temp_path_.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd_ < 0)
+    throw std::runtime_error("Failed to create " + temp_path_);
+}
+
+AtomicFile::~AtomicFile(){
+  if (fd_ >= 0){
+    close(fd_);
+    unlink(temp_path_.c_str());
+  }
+}
+
+void AtomicFile::Write(uint64_t offset, const void *data, size_t length){
+  const char *bytes = static_cast<const char*>(data);
+  while (length > 0){
+    ssize_t written = pwrite(fd_, bytes, length, offset);
+    if (written <= 0)
+      throw std::runtime_error("Failed to write " + temp_path_);
+    bytes += written;
+    offset += written;
+    length -= written;
+  }
+}
+
+void AtomicFile::Commit(){
+  if (fsync(fd_) != 0 || close(fd_) != 0){
+    fd_ = -1;
+    unlink(temp_path_.c_str());
+    throw std::runtime_error("Failed to write " + temp_path_);
+  }
+  fd_ = -1;
+  if (rename(temp_path_.c_str(), path_.c_str()) != 0){
+    unlink(temp_path_.c_str());
+    throw std::runtime_error("Failed to publish " + path_);
+  }
+  //the rename itself is durable once the directory holding it is synced
+  size_t slash = path_.rfind('/');
+  std::string directory = slash == std::string::npos ? "." : slash == 0 ? "/" : path_.substr(0, slash);
+  int directory_fd = open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+  if (directory_fd < 0)
+    throw std::runtime_error("Failed to sync the directory of " + path_);
+  int synced = fsync(directory_fd);
+  close(directory_fd);
+  if (synced != 0)
+    throw std::runtime_error("Failed to sync the directory of " + path_);
+}
+
+void ParallelWriter::WriteBinary(AtomicFile& file, uint64_t offset, const void *data, size_t length){
+  const char *bytes = static_cast<const char*>(data);
+  int threads = std::max<size_t>( 1, std::min<size_t>( mParallel::Threads(), length / kMinimumParallelWrite ) );
+  mParallel::For(0, length, [&](int thread_id, long long begin, long long end){
+      if (end > begin)
+        file.Write(offset + begin, bytes + begin, end - begin);
+    }, threads);
+}
+
+char* ParallelWriter::FormatInteger(long long value, char *out){
+  unsigned long long magnitude = value;
+  if (value < 0){
+    *out++ = '-';
+    magnitude = 0ULL - magnitude;
+  }
+  char digits[20];
+  char *p = digits + sizeof(digits);
+  while (magnitude >= 100){
+    int pair = ( magnitude % 100 ) * 2;
+    magnitude /= 100;
+    *--p = kDigitPairs[pair + 1];
+    *--p = kDigitPairs[pair];
+  }
+  if (magnitude >= 10){
+    *--p = kDigitPairs[ magnitude * 2 + 1 ];
+    *--p = kDigitPairs[ magnitude * 2 ];
+  }else{
+    *--p = '0' + magnitude;
+  }
+  size_t length = digits + sizeof(digits) - p;
+  memcpy(out, p, length);
+  return out + length;
+}
@@ -0,0 +1,88 @@
+#ifndef GRAPH_IO_
+#define GRAPH_IO_
+
+#include "utility.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+//a file written under a temporary name next to path and renamed over it by Commit,
+//readers see either the previous file or the complete new one, never a partial write.
+//Commit syncs the file and then its directory, so the new file survives a crash.
+//Write may be called from several threads at once
+class AtomicFile{
+
+ public:
+
+  //without overwrite an existing path is an error, as FilePath::CheckForExistence
+  AtomicFile(const std::string& path, bool overwrite = 0);
+  //drops the temporary file unless it was committed
+  ~AtomicFile();
+
+  void Write(uint64_t offset, const void *data, size_t length);
+  void Commit();
+
+  const std::string& GetPath() const { return path_; }
+
+ private:
+
+  AtomicFile(const AtomicFile&);
+  AtomicFile& operator=(const AtomicFile&);
+
+  std::string path_;
+  std::string temp_path_;
+  int fd_;
+
+};
+
+class ParallelWriter{
+
+ public:
+
+  //splits data into pieces written by all threads
+  static void WriteBinary(AtomicFile& file, uint64_t offset, const void *data, size_t length);
+
+  //one integer per line, formatted by all threads without the stream machinery,
+  //returns the offset after the last line
+  template<class T>
+  static uint64_t WriteText(AtomicFile& file, uint64_t offset, const T *array, long long size);
+
+  //writes the decimal form of value at out, returns the end of it
+  static char* FormatInteger(long long value, char *out);
+
+};
+
+template<class T>
+uint64_t ParallelWriter::WriteText(AtomicFile& file, uint64_t offset, const T *array, long long size){
+  //the numbers are formatted in rounds so that the buffers stay small
+  const long long kRoundPerThread = 1 << 20;
+  int threads = mParallel::Threads();
+  std::vector<std::string> buffers(threads);
+  std::vector<uint64_t> positions(threads + 1);
+  for(long long round = 0; round < size; round += kRoundPerThread * threads){
+    long long round_end = std::min(size, round + kRoundPerThread * threads);
+    mParallel::For(round, round_end, [&](int thread_id, long long begin, long long end){
+        std::string &buffer = buffers[thread_id];
+        buffer.resize( ( end - begin ) * 21 );
+        char *out = &buffer[0];
+        for(long long i = begin; i < end; i++){
+          out = FormatInteger(array[i], out);
+          *out++ = '\n';
+        }
+        buffer.resize( out - &buffer[0] );
+      }, threads);
+    positions[0] = offset;
+    for(int i = 0; i < threads; i++)
+      positions[i+1] = positions[i] + buffers[i].size();
+    mParallel::Run(threads, [&](int thread_id){
+        if (!buffers[thread_id].empty())
+          file.Write(positions[thread_id], buffers[thread_id].data(), buffers[thread_id].size());
+        buffers[thread_id].clear();
+      });
+    offset = positions[threads];
+  }
+  return offset;
+}
+
+#endif
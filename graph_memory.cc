@@ -0,0 +1,281 @@
+#include "graph_memory.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <new>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+
+#if defined(MAP_HUGETLB) && !defined(MAP_HUGE_SHIFT)
+#define MAP_HUGE_SHIFT 26
+#endif
+
+static int huge_pages_policy = kSmallPages;
+
+void GraphMemory::SetHugePages(HugePages policy){
+  __atomic_store_n(&huge_pages_policy, static_cast<int>(policy), __ATOMIC_RELAXED);
+}
+
+HugePages GraphMemory::GetHugePages(){
+  return static_cast<HugePages>( __atomic_load_n(&huge_pages_policy, __ATOMIC_RELAXED) );
+}
+
+size_t GraphMemory::PageSize(HugePages pages){
+  switch (pages){
+  case kTransparentHugePages:
+  case kHugePages2MB:
+    return 1 << 21;
+  case kHugePages1GB:
+    return 1 << 30;
+  default:
+    return 4096;
+  }
+}
+
+HugePages GraphMemory::ExplicitPages(size_t length, HugePages policy){
+  if ( (policy != kHugePages2MB && policy != kHugePages1GB) || length < kHugePageThreshold )
+    return kSmallPages;
+  return policy == kHugePages1GB && length >= PageSize(kHugePages1GB) ? kHugePages1GB : kHugePages2MB;
+}
+
+HugePages GraphMemory::AdviseHugePages(void *address, size_t length){
+#ifdef MADV_HUGEPAGE
+  if (madvise(address, length, MADV_HUGEPAGE) == 0)
+    return kTransparentHugePages;
+#endif
+  return kSmallPages;
+}
+
+const char* GraphMemory::Describe(HugePages pages){
+  switch (pages){
+  case kTransparentHugePages:
+    return "transparent huge pages";
+  case kHugePages2MB:
+    return "2MB huge pages";
+  case kHugePages1GB:
+    return "1GB huge pages";
+  default:
+    return "small pages";
+  }
+}
+
+size_t GraphMemory::MappedPageSize(const void *address){
+  //every mapping of /proc/self/smaps starts with its range, KernelPageSize follows
+  std::ifstream smaps("/proc/self/smaps");
+  uintptr_t target = reinterpret_cast<uintptr_t>(address);
+  bool inside = 0;
+  std::string line;
+  while (std::getline(smaps, line)){
+    unsigned long long begin, end;
+    if (sscanf(line.c_str(), "%llx-%llx ", &begin, &end) == 2 && line.find(':') > line.find(' ')){
+      inside = begin <= target && target < end;
+      continue;
+    }
+    unsigned long long kilobytes;
+    if (inside && sscanf(line.c_str(), "KernelPageSize: %llu kB", &kilobytes) == 1)
+      return kilobytes * 1024;
+  }
+  return 0;
+}
+
+//the memory policies of <numaif.h>, libnuma is not needed for these calls
+static const int kPolicyBind = 2;
+static const int kPolicyInterleave = 3;
+static const unsigned kMoveFlag = 1 << 1;
+static const unsigned long kNodeFlag = 1 << 0;
+static const unsigned long kAddressFlag = 1 << 1;
+const int GraphMemory::kMaxNumaNodes;
+static const int kMaskWords = GraphMemory::kMaxNumaNodes / 64;
+
+int GraphMemory::NumaNodes(){
+  //the online nodes read as a list of ranges, "0-1" on a dual socket host
+  static const int nodes = []{
+    std::ifstream online("/sys/devices/system/node/online");
+    std::string list;
+    int last = 0;
+    if (std::getline(online, list))
+      for(size_t i = 0; i < list.size(); i++)
+        if (isdigit(list[i]) && ( i == 0 || !isdigit(list[i-1]) ))
+          last = std::max(last, atoi(list.c_str() + i));
+    return std::min(last + 1, kMaxNumaNodes);
+  }();
+  return nodes;
+}
+
+int GraphMemory::CurrentNode(int nodes){
+  static int next_thread = 0;
+  static thread_local int real_node = -1;
+  static thread_local int thread = 0;
+  if (real_node < 0){
+    unsigned cpu = 0, node = 0;
+#ifdef SYS_getcpu
+    if (syscall(SYS_getcpu, &cpu, &node, 0) != 0)
+      node = 0;
+#endif
+    real_node = node;
+    thread = __atomic_fetch_add(&next_thread, 1, __ATOMIC_RELAXED);
+  }
+  int real = NumaNodes();
+  if (nodes <= real)
+    return real_node % nodes;
+  int folded = ( nodes - real_node % real + real - 1 ) / real;
+  return real_node % real + real * ( thread % folded );
+}
+
+//[address, address + length) shrunk to whole pages, false when none is left
+static bool WholePages(const void *address, size_t length, uintptr_t *begin, uintptr_t *end){
+  uintptr_t page = GraphMemory::PageSize(kSmallPages);
+  *begin = ( reinterpret_cast<uintptr_t>(address) + page - 1 ) / page * page;
+  *end = ( reinterpret_cast<uintptr_t>(address) + length ) / page * page;
+  return *begin < *end;
+}
+
+static bool SetPolicy(const void *address, size_t length, int mode, const unsigned long *mask){
+  uintptr_t begin, end;
+  if (!WholePages(address, length, &begin, &end))
+    return 1;
+#ifdef SYS_mbind
+  //the kernel reads one bit less than it is told
+  return syscall(SYS_mbind, begin, end - begin, mode, mask, GraphMemory::kMaxNumaNodes + 1, kMoveFlag) == 0;
+#else
+  return 0;
+#endif
+}
+
+bool GraphMemory::BindToNode(const void *address, size_t length, int node){
+  unsigned long mask[kMaskWords] = { 0 };
+  int real = node % NumaNodes();
+  mask[real / 64] = 1UL << ( real % 64 );
+  return SetPolicy(address, length, kPolicyBind, mask);
+}
+
+bool GraphMemory::Interleave(const void *address, size_t length, int nodes){
+  unsigned long mask[kMaskWords] = { 0 };
+  for(int node = 0; node < std::min(nodes, NumaNodes()); node++)
+    mask[node / 64] |= 1UL << ( node % 64 );
+  return SetPolicy(address, length, kPolicyInterleave, mask);
+}
+
+int GraphMemory::PageNode(const void *address){
+#ifdef SYS_get_mempolicy
+  int node = -1;
+  if (syscall(SYS_get_mempolicy, &node, 0, 0, address, kNodeFlag | kAddressFlag) == 0)
+    return node;
+#endif
+  return -1;
+}
+
+//anonymous zero-filled memory with the huge page policy, an empty block when
+//not even small pages can be mapped
+static MemoryBlock AllocateHuge(size_t length, HugePages policy){
+  MemoryBlock block;
+#ifdef MAP_HUGETLB
+  HugePages pages = GraphMemory::ExplicitPages(length, policy);
+  if (pages != kSmallPages){
+    size_t page = GraphMemory::PageSize(pages);
+    size_t rounded = ( length + page - 1 ) / page * page;
+    int shift = pages == kHugePages1GB ? 30 : 21;
+    void *address = mmap(0, rounded, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | ( shift << MAP_HUGE_SHIFT ), -1, 0);
+    if (address != MAP_FAILED){
+      block.address = address;
+      block.length = rounded;
+      block.kind = kAnonymousMemory;
+      block.pages = pages;
+      return block;
+    }
+    //the reserved pool is missing or exhausted, transparent pages come next
+  }
+#endif
+  //transparent huge pages need aligned ranges, the slack around one is given back
+  size_t page = GraphMemory::PageSize(kTransparentHugePages);
+  size_t rounded = ( length + page - 1 ) / page * page;
+  void *mapped = mmap(0, rounded + page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mapped == MAP_FAILED)
+    return block;
+  char *first = static_cast<char*>(mapped);
+  char *aligned = reinterpret_cast<char*>( ( reinterpret_cast<uintptr_t>(first) + page - 1 ) / page * page );
+  if (aligned > first)
+    munmap(first, aligned - first);
+  if (first + page > aligned)
+    munmap(aligned + rounded, first + page - aligned);
+  block.address = aligned;
+  block.length = rounded;
+  block.kind = kAnonymousMemory;
+  block.pages = GraphMemory::AdviseHugePages(aligned, rounded);
+  return block;
+}
+
+MemoryBlock GraphMemory::Allocate(size_t length){
+  MemoryBlock block;
+  if (length == 0)
+    return block;
+  HugePages policy = GetHugePages();
+  if (policy != kSmallPages && length >= kHugePageThreshold){
+    block = AllocateHuge(length, policy);
+    if (block.address)
+      return block;
+  }
+  block.address = calloc(length, 1);
+  if (!block.address)
+    throw std::bad_alloc();
+  block.length = length;
+  block.kind = kHeapMemory;
+  return block;
+}
+
+MemoryBlock GraphMemory::MapFile(const std::string& path, bool populate, bool will_need){
+  MemoryBlock block;
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw std::runtime_error("Failed to open " + path);
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) < 0){
+    close(fd);
+    throw std::runtime_error("Failed to stat " + path);
+  }
+  if (file_stat.st_size == 0){
+    //nothing to map, an empty block is fine for an empty array
+    close(fd);
+    return block;
+  }
+  int flags = MAP_SHARED;
+#ifdef MAP_POPULATE
+  if (populate)
+    flags |= MAP_POPULATE;
+#endif
+  void *address = mmap(0, file_stat.st_size, PROT_READ, flags, fd, 0);
+  //the mapping keeps its own reference to the file
+  close(fd);
+  if (address == MAP_FAILED)
+    throw std::runtime_error("Failed to map " + path);
+  if (will_need)
+    madvise(address, file_stat.st_size, MADV_WILLNEED);
+  block.address = address;
+  block.length = file_stat.st_size;
+  block.kind = kMappedMemory;
+  if ( GetHugePages() != kSmallPages && block.length >= kHugePageThreshold )
+    block.pages = AdviseHugePages(address, block.length);
+  return block;
+}
+
+void GraphMemory::Release(MemoryBlock& block){
+  switch (block.kind){
+  case kHeapMemory:
+    free(block.address);
+    break;
+  case kMappedMemory:
+  case kAnonymousMemory:
+    munmap(block.address, block.length);
+    break;
+  default:
+    break;
+  }
+  block = MemoryBlock();
+}
@@ -0,0 +1,99 @@
+#ifndef GRAPH_MEMORY_
+#define GRAPH_MEMORY_
+
+#include <string>
+#include <cstddef>
+#include <stdexcept>
+
+enum MemoryKind{
+  kNoMemory,
+  kHeapMemory,
+  kMappedMemory,
+  kAnonymousMemory  //writable private mapping, zero-filled
+};
+
+//page sizes the large blocks ask for. explicit huge pages come from the
+//reserved pool and fall back to transparent ones, those are only advised
+//with madvise and the kernel may still leave some ranges on small pages
+enum HugePages{
+  kSmallPages,
+  kTransparentHugePages,
+  kHugePages2MB,
+  kHugePages1GB
+};
+
+//a piece of memory backing one of the CSR arrays,
+//it remembers how it was obtained so that it can be given back properly
+struct MemoryBlock{
+
+MemoryBlock(): address(0), length(0), kind(kNoMemory), pages(kSmallPages){}
+
+  void *address;
+  size_t length;
+  MemoryKind kind;
+  //the page size that took effect
+  HugePages pages;
+
+};
+
+class GraphMemory{
+
+ public:
+
+  //zero-filled heap memory, blocks of kHugePageThreshold bytes or more are
+  //mapped with the huge page policy instead
+  static MemoryBlock Allocate(size_t length);
+
+  //read-only shared mapping of a whole file, the pages stay in the page cache
+  //and are shared by every process mapping the same file. page cache pages
+  //can only be transparent huge ones
+  static MemoryBlock MapFile(const std::string& path, bool populate = 0, bool will_need = 0);
+
+  static void Release(MemoryBlock& block);
+
+  //heap and anonymous blocks can be changed in place
+  static bool IsWritable(const MemoryBlock& block){
+    return block.kind == kHeapMemory || block.kind == kAnonymousMemory;
+  }
+
+  //process-wide policy for the blocks allocated or mapped from now on
+  static void SetHugePages(HugePages policy);
+  static HugePages GetHugePages();
+  //the size of a page of the policy, 4096 for kSmallPages
+  static size_t PageSize(HugePages pages);
+  //the explicit huge pages a block of length bytes is mapped with under policy,
+  //kSmallPages when it takes none. under kHugePages1GB only blocks of a whole
+  //1 GiB page or more take those, smaller ones take 2 MiB pages so that they
+  //do not round up to a page of the pool each
+  static HugePages ExplicitPages(size_t length, HugePages policy);
+  //advises transparent huge pages for [address, address + length),
+  //kSmallPages when the kernel refuses
+  static HugePages AdviseHugePages(void *address, size_t length);
+  static const char* Describe(HugePages pages);
+  //the page size the kernel maps address with, from /proc/self/smaps, 0 when
+  //it cannot tell. transparent huge pages still count as small ones there
+  static size_t MappedPageSize(const void *address);
+
+  static const size_t kHugePageThreshold = 1 << 21;
+
+  //NUMA nodes of the machine, 1 without NUMA support. node numbers past them
+  //are virtual nodes folded onto the real ones, node v is real node
+  //v % NumaNodes(), so that every placement also runs on a single node
+  static int NumaNodes();
+  //the node among nodes the calling thread reads from. its real node is looked
+  //up on its first call, threads sharing it take turns over the virtual nodes
+  //folded onto it
+  static int CurrentNode(int nodes);
+  //binds the pages inside [address, address + length) to node and moves those
+  //already touched, false when the kernel refuses
+  static bool BindToNode(const void *address, size_t length, int node);
+  //spreads them page by page over the real nodes among the first nodes
+  static bool Interleave(const void *address, size_t length, int nodes);
+  //the node holding the page of address, -1 when it cannot tell
+  static int PageNode(const void *address);
+
+  static const int kMaxNumaNodes = 64;
+
+};
+
+#endif
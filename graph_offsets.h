@@ -0,0 +1,61 @@
+#ifndef GRAPH_OFFSETS_
+#define GRAPH_OFFSETS_
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+
+//inclusive end offsets of the adjacency lists of a view. they are 32-bit while
+//the edges of the view fit in an int and 64-bit beyond that, so small graphs
+//keep the compact layout. vertex ids are 32-bit either way
+class EdgeOffsets{
+
+ public:
+
+  EdgeOffsets(): narrow_(0), wide_(0){}
+
+  static bool NeedsWide(long long number_edges){
+    return number_edges > std::numeric_limits<int>::max();
+  }
+
+  bool IsWide() const { return wide_ != 0; }
+  size_t ElementSize() const { return IsWide() ? sizeof(long long) : sizeof(int); }
+  const void* Data() const { return IsWide() ? static_cast<const void*>(wide_) : static_cast<const void*>(narrow_); }
+  int* Narrow() const { return narrow_; }
+  long long* Wide() const { return wide_; }
+
+  long long operator[](int vertex) const { return wide_ ? wide_[vertex] : narrow_[vertex]; }
+  //offset of the first edge of vertex
+  long long Start(int vertex) const { return vertex ? (*this)[vertex-1] : 0; }
+  void Set(int vertex, long long offset){
+    if (wide_)
+      wide_[vertex] = offset;
+    else
+      narrow_[vertex] = static_cast<int>(offset);
+  }
+
+  //first vertex whose list ends after edge
+  int UpperBound(int number_vertex, long long edge) const {
+    if (wide_)
+      return std::upper_bound(wide_, wide_ + number_vertex, edge) - wide_;
+    return std::upper_bound(narrow_, narrow_ + number_vertex, edge) - narrow_;
+  }
+
+  //element_size is sizeof(int) or sizeof(long long)
+  void Bind(void *address, size_t element_size){
+    narrow_ = element_size == sizeof(long long) ? 0 : static_cast<int*>(address);
+    wide_ = element_size == sizeof(long long) ? static_cast<long long*>(address) : 0;
+  }
+  void Reset(){
+    narrow_ = 0;
+    wide_ = 0;
+  }
+
+ private:
+
+  int *narrow_;
+  long long *wide_;
+
+};
+
+#endif
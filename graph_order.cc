@@ -0,0 +1,187 @@
+#include "graph_order.h"
+#include <algorithm>
+#include <cmath>
+
+//ids by decreasing or increasing degree, ties by increasing id
+static std::vector<int> SortByDegree(const std::vector<int>& degree, bool decreasing){
+  int number_vertex = degree.size();
+  int max_degree = 0;
+  for(int i = 0; i < number_vertex; i++)
+    max_degree = std::max(max_degree, degree[i]);
+  std::vector<long long> position(max_degree + 2, 0);
+  for(int i = 0; i < number_vertex; i++)
+    position[ ( decreasing ? max_degree - degree[i] : degree[i] ) + 1 ]++;
+  for(int d = 0; d <= max_degree; d++)
+    position[d+1] += position[d];
+  std::vector<int> order(number_vertex);
+  for(int i = 0; i < number_vertex; i++)
+    order[ position[ decreasing ? max_degree - degree[i] : degree[i] ]++ ] = i;
+  return order;
+}
+
+std::vector<int> GraphOrder::Degree(int number_vertex, const Adjacency& out){
+  std::vector<int> degree(number_vertex);
+  mParallel::For(0, number_vertex, [&](int thread_id, long long begin, long long end){
+      for(long long i = begin; i < end; i++)
+        degree[i] = out.Degree(i);
+    });
+  return SortByDegree(degree, 1);
+}
+
+std::vector<int> GraphOrder::ReverseCuthillMcKee(int number_vertex, const Adjacency& out, const Adjacency& in){
+  std::vector<int> degree(number_vertex);
+  mParallel::For(0, number_vertex, [&](int thread_id, long long begin, long long end){
+      for(long long i = begin; i < end; i++)
+        degree[i] = out.Degree(i) + in.Degree(i);
+    });
+  auto lighter = [&](int a, int b){ return degree[a] < degree[b] || ( degree[a] == degree[b] && a < b ); };
+
+  //breadth first from root over the vertices not marked with stamp yet,
+  //returns where the last level starts in visit
+  std::vector<int> next;
+  auto traverse = [&](int root, std::vector<int>& marks, int stamp, std::vector<int>& visit){
+    size_t level = visit.size(), level_end = visit.size() + 1;
+    visit.push_back(root);
+    marks[root] = stamp;
+    for(size_t head = level; head < visit.size(); head++){
+      if (head == level_end){
+        level = head;
+        level_end = visit.size();
+      }
+      int u = visit[head];
+      next.clear();
+      for(const int *p = out.Begin(u); p != out.End(u); p++)
+        if (marks[*p] != stamp){
+          marks[*p] = stamp;
+          next.push_back(*p);
+        }
+      for(const int *p = in.Begin(u); p != in.End(u); p++)
+        if (marks[*p] != stamp){
+          marks[*p] = stamp;
+          next.push_back(*p);
+        }
+      std::sort(next.begin(), next.end(), lighter);
+      visit.insert(visit.end(), next.begin(), next.end());
+    }
+    return level;
+  };
+
+  //a component starts from its lightest vertex, a first traversal finds the
+  //lightest vertex of the last level, far from it, to start the real one
+  std::vector<int> seen(number_vertex, 0), placed(number_vertex, 0), scratch, order;
+  order.reserve(number_vertex);
+  int component = 0;
+  for(int root: SortByDegree(degree, 0)){
+    if (placed[root])
+      continue;
+    scratch.clear();
+    size_t last = traverse(root, seen, ++component, scratch);
+    int start = *std::min_element(scratch.begin() + last, scratch.end(), lighter);
+    traverse(start, placed, 1, order);
+  }
+  std::reverse(order.begin(), order.end());
+  return order;
+}
+
+//max-priority queue over the vertices whose priorities only ever move by one,
+//every priority has a doubly linked bucket so that both moves are O(1)
+class UnitHeap{
+
+ public:
+
+  explicit UnitHeap(int size): key_(size, 0), previous_(size), next_(size), removed_(size, 0), head_(1, -1), top_(0){
+    for(int i = size - 1; i >= 0; i--)
+      Link(i);
+  }
+
+  void Add(int vertex, int delta){
+    if (removed_[vertex])
+      return;
+    Unlink(vertex);
+    key_[vertex] += delta;
+    Link(vertex);
+  }
+
+  void Remove(int vertex){
+    Unlink(vertex);
+    removed_[vertex] = 1;
+  }
+
+  //one of the vertices of the highest priority
+  int Pop(){
+    while (head_[top_] < 0)
+      top_--;
+    int vertex = head_[top_];
+    Remove(vertex);
+    return vertex;
+  }
+
+ private:
+
+  void Link(int vertex){
+    int key = key_[vertex];
+    if (key >= static_cast<int>( head_.size() ))
+      head_.resize(key + 1, -1);
+    previous_[vertex] = -1;
+    next_[vertex] = head_[key];
+    if (next_[vertex] >= 0)
+      previous_[ next_[vertex] ] = vertex;
+    head_[key] = vertex;
+    top_ = std::max(top_, key);
+  }
+
+  void Unlink(int vertex){
+    if (previous_[vertex] >= 0)
+      next_[ previous_[vertex] ] = next_[vertex];
+    else
+      head_[ key_[vertex] ] = next_[vertex];
+    if (next_[vertex] >= 0)
+      previous_[ next_[vertex] ] = previous_[vertex];
+  }
+
+  std::vector<int> key_;
+  std::vector<int> previous_;
+  std::vector<int> next_;
+  std::vector<char> removed_;
+  std::vector<int> head_;
+  int top_;
+
+};
+
+std::vector<int> GraphOrder::Gorder(int number_vertex, const Adjacency& out, const Adjacency& in, int window){
+  std::vector<int> order;
+  order.reserve(number_vertex);
+  if (!number_vertex)
+    return order;
+  int huge = std::max( 1, static_cast<int>( std::sqrt( static_cast<double>(number_vertex) ) ) );
+  UnitHeap heap(number_vertex);
+  //the priority of v counts the window vertices u with an edge u->v or v->u
+  //and the in-neighbors shared with them
+  auto update = [&](int u, int delta){
+    for(const int *p = out.Begin(u); p != out.End(u); p++)
+      heap.Add(*p, delta);
+    for(const int *p = in.Begin(u); p != in.End(u); p++){
+      heap.Add(*p, delta);
+      if (out.Degree(*p) <= huge)
+        for(const int *q = out.Begin(*p); q != out.End(*p); q++)
+          if (*q != u)
+            heap.Add(*q, delta);
+    }
+  };
+
+  //the vertex with the most in-neighbors goes first
+  int start = 0;
+  for(int i = 1; i < number_vertex; i++)
+    if (in.Degree(i) > in.Degree(start))
+      start = i;
+  heap.Remove(start);
+  for(int vertex = start; ; vertex = heap.Pop()){
+    order.push_back(vertex);
+    if (static_cast<int>( order.size() ) == number_vertex)
+      break;
+    update(vertex, 1);
+    if (static_cast<int>( order.size() ) > window)
+      update(order[ order.size() - 1 - window ], -1);
+  }
+  return order;
+}
@@ -0,0 +1,43 @@
+#ifndef GRAPH_ORDER_
+#define GRAPH_ORDER_
+
+#include "utility.h"
+#include "graph_offsets.h"
+#include <vector>
+
+//the adjacency lists of one view as BasicGraph keeps them
+struct Adjacency{
+
+Adjacency(const EdgeOffsets& boundaries, const int *targets): boundaries(boundaries), targets(targets){}
+
+  const int* Begin(int vertex) const { return targets + boundaries.Start(vertex); }
+  const int* End(int vertex) const { return targets + boundaries[vertex]; }
+  int Degree(int vertex) const { return boundaries[vertex] - boundaries.Start(vertex); }
+
+  EdgeOffsets boundaries;
+  const int *targets;
+
+};
+
+//vertex orders for BasicGraph::Reorder. every function returns the old ids
+//in their new order, order[new_id] = old_id
+class GraphOrder{
+
+ public:
+
+  //decreasing out degree, ties by increasing id
+  static std::vector<int> Degree(int number_vertex, const Adjacency& out);
+
+  //reverse Cuthill-McKee over the edges of either direction: every component
+  //is traversed breadth first from a pseudo-peripheral vertex, neighbors by
+  //increasing degree, and the whole order is reversed
+  static std::vector<int> ReverseCuthillMcKee(int number_vertex, const Adjacency& out, const Adjacency& in);
+
+  //Gorder: greedily places next the vertex sharing the most edges and common
+  //in-neighbors with the last window vertices placed. in-neighbors whose out
+  //degree exceeds sqrt(n) are not followed to their siblings
+  static std::vector<int> Gorder(int number_vertex, const Adjacency& out, const Adjacency& in, int window = 5);
+
+};
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef GRAPH_RANDOM_
+#define GRAPH_RANDOM_
+
+#include <cstdint>
+
+//Philox4x32-10 counter-based generator: the words drawn for a counter depend
+//on the key and the counter only, so any thread can draw the numbers of any
+//edge and a seed gives the same graph on every machine and thread count
+class Philox{
+
+ public:
+
+  static void Generate(uint64_t key, uint64_t counter_low, uint64_t counter_high, uint32_t out[4]){
+    uint32_t counter[4] = { static_cast<uint32_t>(counter_low), static_cast<uint32_t>(counter_low >> 32),
+                            static_cast<uint32_t>(counter_high), static_cast<uint32_t>(counter_high >> 32) };
+    uint32_t key_low = static_cast<uint32_t>(key), key_high = static_cast<uint32_t>(key >> 32);
+    for(int round = 0; round < 10; round++){
+      uint64_t product0 = static_cast<uint64_t>(kMultiplier0) * counter[0];
+      uint64_t product1 = static_cast<uint64_t>(kMultiplier1) * counter[2];
+      uint32_t next[4] = { static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ key_low, static_cast<uint32_t>(product1),
+                           static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ key_high, static_cast<uint32_t>(product0) };
+      for(int i = 0; i < 4; i++)
+        counter[i] = next[i];
+      key_low += kWeyl0;
+      key_high += kWeyl1;
+    }
+    for(int i = 0; i < 4; i++)
+      out[i] = counter[i];
+  }
+
+  //uniform in [0, 1)
+  static double Uniform(uint32_t word){
+    return word * ( 1.0 / 4294967296.0 );
+  }
+
+ private:
+
+  static const uint32_t kMultiplier0 = 0xD2511F53;
+  static const uint32_t kMultiplier1 = 0xCD9E8D57;
+  static const uint32_t kWeyl0 = 0x9E3779B9;
+  static const uint32_t kWeyl1 = 0xBB67AE85;
+
+};
+
+//draws in order from the counters (0, stream), (1, stream)... of a seed,
+//every generator task owns a stream so the tasks can run on any thread
+class RandomStream{
+
+ public:
+
+  RandomStream(uint64_t seed, uint64_t stream): seed_(seed), stream_(stream), index_(0), used_(4){}
+
+  uint32_t Next(){
+    if (used_ == 4){
+      Philox::Generate(seed_, index_++, stream_, words_);
+      used_ = 0;
+    }
+    return words_[ used_++ ];
+  }
+
+  double Uniform(){ return Philox::Uniform( Next() ); }
+
+  //uniform in [0, bound)
+  uint64_t Below(uint64_t bound){
+    uint64_t word = static_cast<uint64_t>( Next() ) << 32;
+    word |= Next();
+    return static_cast<uint64_t>( ( static_cast<unsigned __int128>(word) * bound ) >> 64 );
+  }
+
+ private:
+
+  uint64_t seed_;
+  uint64_t stream_;
+  uint64_t index_;
+  int used_;
+  uint32_t words_[4];
+
+};
+
+#endif
@@ -0,0 +1,105 @@
+#include "graph_sets.h"
+#include <algorithm>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+//counts, or writes when kWrite, the values of a found in b
+template<bool kWrite>
+static size_t IntersectionImpl(const int *a, size_t size_a, const int *b, size_t size_b, int *out){
+  size_t i = 0, j = 0, count = 0;
+#ifdef __SSE2__
+  //four values of a against all four rotations of four values of b,
+  //then the block with the smaller last value moves on
+  while (i + 4 <= size_a && j + 4 <= size_b){
+    __m128i va = _mm_loadu_si128( reinterpret_cast<const __m128i*>( a + i ) );
+    __m128i vb = _mm_loadu_si128( reinterpret_cast<const __m128i*>( b + j ) );
+    __m128i match = _mm_or_si128(
+      _mm_or_si128( _mm_cmpeq_epi32(va, vb), _mm_cmpeq_epi32( va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1)) ) ),
+      _mm_or_si128( _mm_cmpeq_epi32( va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2)) ),
+                    _mm_cmpeq_epi32( va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3)) ) ) );
+    int mask = _mm_movemask_ps( _mm_castsi128_ps(match) );
+    if (kWrite){
+      for(; mask; mask &= mask - 1)
+        out[count++] = a[ i + __builtin_ctz(mask) ];
+    }else{
+      count += __builtin_popcount(mask);
+    }
+    int last_a = a[i+3], last_b = b[j+3];
+    if (last_a <= last_b)
+      i += 4;
+    if (last_b <= last_a)
+      j += 4;
+  }
+#endif
+  while (i < size_a && j < size_b){
+    if (a[i] < b[j]){
+      i++;
+    }else
+      if (a[i] > b[j]){
+        j++;
+      }else{
+        if (kWrite)
+          out[count] = a[i];
+        count++;
+        i++;
+        j++;
+      }
+  }
+  return count;
+}
+
+size_t SortedSets::IntersectionSize(const int *a, size_t size_a, const int *b, size_t size_b){
+  return IntersectionImpl<false>(a, size_a, b, size_b, 0);
+}
+
+size_t SortedSets::Intersection(const int *a, size_t size_a, const int *b, size_t size_b, int *out){
+  return IntersectionImpl<true>(a, size_a, b, size_b, out);
+}
+
+size_t SortedSets::Union(const int *a, size_t size_a, const int *b, size_t size_b, int *out){
+  size_t i = 0, j = 0, count = 0;
+  //the smaller head goes out, both move on when they are equal
+  while (i < size_a && j < size_b){
+    int x = a[i], y = b[j];
+    out[count++] = x < y ? x : y;
+    i += x <= y;
+    j += y <= x;
+  }
+  for(; i < size_a; i++)
+    out[count++] = a[i];
+  for(; j < size_b; j++)
+    out[count++] = b[j];
+  return count;
+}
+
+size_t SortedSets::IntersectionUnion(const int *a, size_t size_a, const int *b, size_t size_b,
+                                     int *intersection_out, int *union_out, size_t& intersection_size){
+  size_t i = 0, j = 0, count = 0, common = 0;
+  while (i < size_a && j < size_b){
+    int x = a[i], y = b[j];
+    union_out[count++] = x < y ? x : y;
+    if (x == y)
+      intersection_out[common++] = x;
+    i += x <= y;
+    j += y <= x;
+  }
+  for(; i < size_a; i++)
+    union_out[count++] = a[i];
+  for(; j < size_b; j++)
+    union_out[count++] = b[j];
+  intersection_size = common;
+  return count;
+}
+
+const int* SortedSets::Normalize(const int *list, size_t& size, std::vector<int>& buffer){
+  size_t i = 1;
+  while (i < size && list[i-1] < list[i])
+    i++;
+  if (i >= size)
+    return list;
+  buffer.assign(list, list + size);
+  std::sort(buffer.begin(), buffer.end());
+  size = std::unique(buffer.begin(), buffer.end()) - buffer.begin();
+  return buffer.data();
+}
@@ -0,0 +1,32 @@
+#ifndef GRAPH_SETS_
+#define GRAPH_SETS_
+
+#include <cstddef>
+#include <vector>
+
+//set operations on strictly increasing int arrays, the building blocks of the
+//INTERSECTION and UNION views. the Size functions only count, the others
+//write the result, strictly increasing, at out and return its size
+class SortedSets{
+
+ public:
+
+  static size_t IntersectionSize(const int *a, size_t size_a, const int *b, size_t size_b);
+  static size_t Intersection(const int *a, size_t size_a, const int *b, size_t size_b, int *out);
+
+  static size_t UnionSize(const int *a, size_t size_a, const int *b, size_t size_b){
+    return size_a + size_b - IntersectionSize(a, size_a, b, size_b);
+  }
+  static size_t Union(const int *a, size_t size_a, const int *b, size_t size_b, int *out);
+
+  //both results from a single merge, the intersection size goes to intersection_size
+  static size_t IntersectionUnion(const int *a, size_t size_a, const int *b, size_t size_b,
+                                  int *intersection_out, int *union_out, size_t& intersection_size);
+
+  //list itself when it is strictly increasing already, otherwise a sorted
+  //copy without duplicates kept in buffer. size is updated to match
+  static const int* Normalize(const int *list, size_t& size, std::vector<int>& buffer);
+
+};
+
+#endif
@@ -1,42 +1,436 @@
 #include "graph_share.h"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <vector>
 
-void Clear(){
-  if (!set_)
+#if defined(SHM_HUGETLB) && !defined(SHM_HUGE_SHIFT)
+#define SHM_HUGE_SHIFT 26
+#endif
+#if defined(MFD_HUGETLB) && !defined(MFD_HUGE_SHIFT)
+#define MFD_HUGE_SHIFT 26
+#endif
+
+//explicit huge pages are what the kernel maps the segment with, transparent
+//ones are only asked for when the policy wants huge pages
+static HugePages SegmentPages(void *shm, size_t size){
+  size_t page = GraphMemory::MappedPageSize(shm);
+  if (page >= GraphMemory::PageSize(kHugePages1GB))
+    return kHugePages1GB;
+  if (page >= GraphMemory::PageSize(kHugePages2MB))
+    return kHugePages2MB;
+  if (GraphMemory::GetHugePages() == kSmallPages || size < GraphMemory::kHugePageThreshold)
+    return kSmallPages;
+  return GraphMemory::AdviseHugePages(shm, size);
+}
+
+void SharedGraph::Clear(){
+  if (!shm_)
     return;
-  set_=0;
-  if (created_by_me_){
-    shmdt(shm_);
-    
-  }else{
-    shmdt(shm_);
-  }
+  graph_.Clear();
+  shmdt(shm_);
+  shm_=0;
 }
 
-SharedGraphResult SharedGraph::LoadSharedGraph(int shmkey, int shmsize){
+void SharedGraph::Remove(){
+  if (shmid_>=0)
+    shmctl(shmid_, IPC_RMID, 0);
+  shmid_=-1;
+}
+
+SharedGraphResult SharedGraph::LoadSharedGraph(key_t shmkey, const int parameter){
   Clear();
-  created_by_me_=0;
-  set_=1;
-  shmid_=shmget(shmkey, shmsize, 0666);
-  if (shmid_<0)
+  int shmid=shmget(shmkey, 0, 0);
+  if (shmid<0)
     return LoadingWrongKey;
-  shm_=shmat(shmid_, NULL, 0);
-  char *shm_chr=static_cast<char*>( shm_ );
-  if ( shm_chr == (char*)-1 )
+  return AttachSharedGraph(shmid, parameter);
+}
+
+SharedGraphResult SharedGraph::AttachSharedGraph(int shmid, const int parameter){
+  Clear();
+  //the id is only kept once the segment is attached, Remove must not reach
+  //a segment this graph never held
+  shmid_=-1;
+  struct shmid_ds status;
+  if (shmctl(shmid, IPC_STAT, &status)<0)
+    return LoadingWrongKey;
+  void *shm=shmat(shmid, NULL, SHM_RDONLY);
+  if (shm == reinterpret_cast<void*>(-1))
     return LoadingWrongMemory;
-  graph_=reinterpret_cast<BasicGraph*>(shm_chr);
+  shm_=shm;
+  pages_=SegmentPages(shm_, status.shm_segsz);
+  try{
+    graph_.AttachImage(static_cast<const char*>(shm_), status.shm_segsz, parameter);
+  }catch(std::runtime_error &e){
+    Clear();
+    return LoadingWrongImage;
+  }
+  shmid_=shmid;
+  return SharingDone;
 }
 
-SharedGraphResult SharedGraph::CreateSharedGraph(BasicGraph *g){
+SharedGraphResult SharedGraph::CreateSharedGraph(const BasicGraph& graph, key_t shmkey, const int parameter){
   Clear();
-  graph_=g;
-  set_=1;
-  created_by_me_=1;
-  int key=(int)g;
-  shmid_=shmget(key, sizeof(*graph_), IPC_CREATE | 0666);
-  if (shmid_<0)
+  mProcess share_process("Publication of shared graph", 1, verbose_);
+  share_process.Start();
+  size_t size=graph.ImageSize(parameter);
+  HugePages policy=GraphMemory::GetHugePages();
+  //the segment held so far stays known to Remove when no new one can be had
+  int shmid=-1;
+#ifdef SHM_HUGETLB
+  HugePages pages=GraphMemory::ExplicitPages(size, policy);
+  if (pages != kSmallPages){
+    size_t page=GraphMemory::PageSize(pages);
+    int shift=pages == kHugePages1GB ? 30 : 21;
+    shmid=shmget(shmkey, ( size + page - 1 ) / page * page, IPC_CREAT | IPC_EXCL | 0644 | SHM_HUGETLB | ( shift << SHM_HUGE_SHIFT ));
+    if (shmid<0 && errno == EEXIST)
+      return WritingWrongKey;
+  }
+#endif
+  //small pages when the huge page pool cannot hold the segment
+  if (shmid<0)
+    shmid=shmget(shmkey, size, IPC_CREAT | IPC_EXCL | 0644);
+  if (shmid<0)
     return WritingWrongKey;
-  shm_=static_cast<char*>(shmat(shmid_, NULL, 0));
-  if (shm_ == (char*)-1)
+  shmid_=shmid;
+  void *shm=shmat(shmid_, NULL, 0);
+  if (shm == reinterpret_cast<void*>(-1)){
+    Remove();
+    return WritingWrongMemory;
+  }
+  shm_=shm;
+  pages_=SegmentPages(shm_, size);
+  try{
+    graph.WriteImage(static_cast<char*>(shm_), parameter);
+  }catch(...){
+    shmdt(shm_);
+    shm_=0;
+    Remove();
+    throw;
+  }
+  graph_.AttachImage(static_cast<const char*>(shm_), size);
+  share_process.Stop();
+  return SharingDone;
+}
+
+static const char kControlMagic[8] = { 'H', 'K', 'V', 'E', 'R', 'S', '\0', '\0' };
+//a replaced segment may be gone before it is attached, the word is read again then
+static const int kRefreshAttempts = 8;
+
+//the control block of key, created when create is set, 0 when it cannot be attached
+static SharedGraphControl* AttachControl(key_t key, bool create, int *shmid){
+  *shmid=shmget(key, sizeof(SharedGraphControl), create ? IPC_CREAT | 0644 : 0);
+  if (*shmid<0)
+    return 0;
+  void *shm=shmat(*shmid, NULL, create ? 0 : SHM_RDONLY);
+  if (shm == reinterpret_cast<void*>(-1))
+    return 0;
+  SharedGraphControl *control=static_cast<SharedGraphControl*>(shm);
+  //a new segment is zero-filled, its word says that there is no version yet
+  if (create && memcmp(control->magic, kControlMagic, sizeof(kControlMagic)) != 0)
+    memcpy(control->magic, kControlMagic, sizeof(kControlMagic));
+  return control;
+}
+
+SharedGraphPublisher::~SharedGraphPublisher(){
+  if (control_)
+    shmdt(control_);
+}
+
+uint32_t SharedGraphPublisher::GetVersion() const{
+  return control_ ? __atomic_load_n(&control_->current, __ATOMIC_ACQUIRE) >> 32 : 0;
+}
+
+SharedGraphResult SharedGraphPublisher::Publish(const BasicGraph& graph, const int parameter){
+  if (!control_ && !( control_=AttachControl(control_key_, 1, &control_id_) ))
+    return WritingWrongKey;
+  SharedGraph next(verbose_);
+  SharedGraphResult result=next.CreateSharedGraph(graph, IPC_PRIVATE, parameter);
+  if (result != SharingDone)
+    return result;
+  uint64_t previous=__atomic_load_n(&control_->current, __ATOMIC_ACQUIRE);
+  uint64_t current=( ( previous >> 32 ) + 1 ) << 32 | static_cast<uint32_t>( next.GetId() );
+  //a second publisher of the key loses the race and takes its segment back
+  if (!__atomic_compare_exchange_n(&control_->current, &previous, current, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)){
+    next.Remove();
+    return WritingWrongKey;
+  }
+  if (previous)
+    shmctl(static_cast<int>( previous & 0xffffffff ), IPC_RMID, 0);
+  return SharingDone;
+}
+
+void SharedGraphPublisher::Remove(){
+  if (!control_)
+    return;
+  uint64_t previous=__atomic_exchange_n(&control_->current, 0, __ATOMIC_ACQ_REL);
+  if (previous)
+    shmctl(static_cast<int>( previous & 0xffffffff ), IPC_RMID, 0);
+  shmdt(control_);
+  shmctl(control_id_, IPC_RMID, 0);
+  control_=0;
+  control_id_=-1;
+}
+
+SharedGraphReader::~SharedGraphReader(){
+  if (control_)
+    shmdt(control_);
+}
+
+SharedGraphResult SharedGraphReader::Refresh(){
+  int control_id;
+  if (!control_ && !( control_=AttachControl(control_key_, 0, &control_id) ))
+    return LoadingWrongKey;
+  SharedGraphResult result=LoadingWrongKey;
+  for(int attempt=0; attempt<kRefreshAttempts; attempt++){
+    uint64_t current=__atomic_load_n(&control_->current, __ATOMIC_ACQUIRE);
+    if (!current)
+      return LoadingWrongKey;
+    //the magic is in place before the first version is
+    if (memcmp(control_->magic, kControlMagic, sizeof(kControlMagic)) != 0)
+      return LoadingWrongImage;
+    uint32_t version=current >> 32;
+    if (version == version_)
+      return SharingDone;
+    SharedGraph &next=graphs_[ 1 - current_ ];
+    result=next.AttachSharedGraph(static_cast<int>( current & 0xffffffff ), parameter_);
+    if (result == SharingDone){
+      graphs_[current_].Clear();
+      current_=1 - current_;
+      version_=version;
+      return SharingDone;
+    }
+    if (__atomic_load_n(&control_->current, __ATOMIC_ACQUIRE) == current)
+      break;
+  }
+  return result;
+}
+
+//a client that cannot grow, shrink or change the image may read it in place
+static const int kImageSeals = F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE;
+
+void MemfdGraph::Clear(){
+  if (image_){
+    graph_.Clear();
+    munmap(image_, size_);
+  }
+  if (fd_>=0)
+    close(fd_);
+  image_=0;
+  size_=0;
+  fd_=-1;
+}
+
+//a memfd of length bytes mapped writable, -1 when it cannot be had
+static int CreateImage(size_t length, unsigned flags, void **image){
+  int fd=memfd_create("graph", MFD_CLOEXEC | MFD_ALLOW_SEALING | flags);
+  if (fd<0)
+    return -1;
+  if (ftruncate(fd, length)<0 || ( *image=mmap(0, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) ) == MAP_FAILED){
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+SharedGraphResult MemfdGraph::CreateSharedGraph(const BasicGraph& graph, const int parameter){
+  Clear();
+  mProcess share_process("Publication of sealed graph", 1, verbose_);
+  share_process.Start();
+  size_t size=graph.ImageSize(parameter);
+  HugePages policy=GraphMemory::GetHugePages();
+  int fd=-1;
+  size_t length=size;
+  void *image=0;
+#ifdef MFD_HUGETLB
+  HugePages pages=GraphMemory::ExplicitPages(size, policy);
+  if (pages != kSmallPages){
+    size_t page=GraphMemory::PageSize(pages);
+    int shift=pages == kHugePages1GB ? 30 : 21;
+    length=( size + page - 1 ) / page * page;
+    fd=CreateImage(length, MFD_HUGETLB | ( shift << MFD_HUGE_SHIFT ), &image);
+  }
+#endif
+  //small pages when the huge page pool cannot hold the image
+  if (fd<0){
+    length=size;
+    fd=CreateImage(length, 0, &image);
+  }
+  if (fd<0)
     return WritingWrongMemory;
-  memcpy(shm_, graph_, sizeof(*graph_));
+  try{
+    graph.WriteImage(static_cast<char*>(image), parameter);
+  }catch(...){
+    munmap(image, length);
+    close(fd);
+    throw;
+  }
+  //the writable mapping must be gone before the write seal is taken
+  munmap(image, length);
+  if (fcntl(fd, F_ADD_SEALS, kImageSeals | F_SEAL_SEAL)<0){
+    close(fd);
+    return WritingWrongMemory;
+  }
+  SharedGraphResult result=AttachSharedGraph(fd);
+  share_process.Stop();
+  return result;
+}
+
+SharedGraphResult MemfdGraph::AttachSharedGraph(int fd, const int parameter){
+  Clear();
+  fd_=fd;
+  int seals=fcntl(fd_, F_GET_SEALS);
+  if (seals<0 || ( seals & kImageSeals ) != kImageSeals){
+    Clear();
+    return LoadingWrongSeals;
+  }
+  struct stat status;
+  if (fstat(fd_, &status)<0 || status.st_size == 0){
+    Clear();
+    return LoadingWrongMemory;
+  }
+  void *image=mmap(0, status.st_size, PROT_READ, MAP_SHARED, fd_, 0);
+  if (image == MAP_FAILED){
+    Clear();
+    return LoadingWrongMemory;
+  }
+  image_=image;
+  size_=status.st_size;
+  pages_=SegmentPages(image_, size_);
+  try{
+    graph_.AttachImage(static_cast<const char*>(image_), size_, parameter);
+  }catch(std::runtime_error &e){
+    Clear();
+    return LoadingWrongImage;
+  }
+  return SharingDone;
+}
+
+//the address of path, false when it does not fit
+static bool SocketAddress(const std::string& path, struct sockaddr_un *address){
+  memset(address, 0, sizeof(*address));
+  address->sun_family=AF_UNIX;
+  if (path.size() >= sizeof(address->sun_path))
+    return 0;
+  memcpy(address->sun_path, path.c_str(), path.size());
+  return 1;
+}
+
+int MemfdGraph::Listen(const std::string& path){
+  struct sockaddr_un address;
+  if (!SocketAddress(path, &address))
+    return -1;
+  int listener=socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (listener<0)
+    return -1;
+  unlink(path.c_str());
+  if (bind(listener, reinterpret_cast<struct sockaddr*>(&address), sizeof(address))<0 || listen(listener, SOMAXCONN)<0){
+    close(listener);
+    return -1;
+  }
+  return listener;
+}
+
+SharedGraphResult MemfdGraph::Serve(int listener) const{
+  int socket;
+  do
+    socket=accept4(listener, 0, 0, SOCK_CLOEXEC);
+  while (socket<0 && errno == EINTR);
+  if (socket<0)
+    return WritingWrongSocket;
+  SharedGraphResult result=Send(socket);
+  close(socket);
+  return result;
+}
+
+SharedGraphResult MemfdGraph::Send(int socket) const{
+  if (fd_<0)
+    return WritingWrongMemory;
+  //one byte of data carries the descriptor
+  char byte=0;
+  struct iovec data = { &byte, 1 };
+  union{
+    struct cmsghdr header;
+    char buffer[CMSG_SPACE(sizeof(int))];
+  } control;
+  memset(&control, 0, sizeof(control));
+  struct msghdr message;
+  memset(&message, 0, sizeof(message));
+  message.msg_iov=&data;
+  message.msg_iovlen=1;
+  message.msg_control=control.buffer;
+  message.msg_controllen=sizeof(control.buffer);
+  struct cmsghdr *header=CMSG_FIRSTHDR(&message);
+  header->cmsg_level=SOL_SOCKET;
+  header->cmsg_type=SCM_RIGHTS;
+  header->cmsg_len=CMSG_LEN(sizeof(int));
+  memcpy(CMSG_DATA(header), &fd_, sizeof(int));
+  ssize_t sent;
+  do
+    sent=sendmsg(socket, &message, MSG_NOSIGNAL);
+  while (sent<0 && errno == EINTR);
+  return sent == 1 ? SharingDone : WritingWrongSocket;
+}
+
+SharedGraphResult MemfdGraph::Receive(int socket, const int parameter){
+  Clear();
+  char byte;
+  struct iovec data = { &byte, 1 };
+  union{
+    struct cmsghdr header;
+    char buffer[CMSG_SPACE(sizeof(int))];
+  } control;
+  struct msghdr message;
+  memset(&message, 0, sizeof(message));
+  message.msg_iov=&data;
+  message.msg_iovlen=1;
+  message.msg_control=control.buffer;
+  message.msg_controllen=sizeof(control.buffer);
+  ssize_t received;
+  do
+    received=recvmsg(socket, &message, MSG_CMSG_CLOEXEC);
+  while (received<0 && errno == EINTR);
+  if (received<0)
+    return LoadingWrongSocket;
+  //every descriptor that arrived is ours now, those of a message that is
+  //not exactly one descriptor are closed instead of leaked
+  std::vector<int> fds;
+  for(struct cmsghdr *header=CMSG_FIRSTHDR(&message); header; header=CMSG_NXTHDR(&message, header)){
+    if (header->cmsg_level != SOL_SOCKET || header->cmsg_type != SCM_RIGHTS || header->cmsg_len < CMSG_LEN(0))
+      continue;
+    size_t count=( header->cmsg_len - CMSG_LEN(0) ) / sizeof(int);
+    for(size_t i=0; i<count; i++){
+      int fd;
+      memcpy(&fd, CMSG_DATA(header) + i * sizeof(int), sizeof(int));
+      fds.push_back(fd);
+    }
+  }
+  if (received != 1 || fds.size() != 1 || ( message.msg_flags & MSG_CTRUNC )){
+    for(size_t i=0; i<fds.size(); i++)
+      close(fds[i]);
+    return LoadingWrongSocket;
+  }
+  return AttachSharedGraph(fds[0], parameter);
+}
+
+SharedGraphResult MemfdGraph::Connect(const std::string& path, const int parameter){
+  Clear();
+  struct sockaddr_un address;
+  if (!SocketAddress(path, &address))
+    return LoadingWrongSocket;
+  int socket=::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (socket<0)
+    return LoadingWrongSocket;
+  if (connect(socket, reinterpret_cast<struct sockaddr*>(&address), sizeof(address))<0){
+    close(socket);
+    return LoadingWrongSocket;
+  }
+  SharedGraphResult result=Receive(socket, parameter);
+  close(socket);
+  return result;
 }
@@ -6,53 +6,225 @@
 #include <sys/ipc.h>
 #include <sys/shm.h>
 #include <sys/types.h>
-#include <map>
+#include <string>
 
 enum SharedGraphResult{
+  SharingDone,
   LoadingWrongKey,
   LoadingWrongMemory,
+  LoadingWrongImage,
   WritingWrongKey,
-  WritingWrongMemory
+  WritingWrongMemory,
+  LoadingWrongSeals,
+  LoadingWrongSocket,
+  WritingWrongSocket
 };
 
+//a graph published in a SysV shared memory segment as a container image.
+//every array is found by its offset from the start of the segment, so each
+//process attaches it wherever it likes and reads the views in place
 class SharedGraph{
-  
+
  public:
 
   SharedGraph(bool verbose=0)
-    :verbose_(verbose){}
+    :graph_(verbose), shmid_(-1), shm_(0), pages_(kSmallPages), verbose_(verbose){}
 
-  ~SharedGraph(){}
+  ~SharedGraph(){
+    Clear();
+  }
 
-  const BasicGraph*
+  //read-only, 0 until a segment is attached
+  const BasicGraph* GetGraph() const {
+    return shm_ ? &graph_ : 0;
+  }
 
-  BasicGraph* GetGraph(){
-    return graph_;
+  //the pages of the segment. CreateSharedGraph follows GraphMemory::GetHugePages,
+  //explicit huge pages come from SHM_HUGETLB and fall back to transparent ones
+  HugePages GetHugePages() const {
+    return pages_;
   }
 
-  BasicGraph const* GetGraph(){
-    return graph_;
+  int GetId() const {
+    return shmid_;
   }
 
+  //detaches the segment, which lives on until Remove
   void Clear();
 
-  SharedGraphResult LoadSharedGraph(int shmkey, int shmsize);
+  //the segment is destroyed once the last process detaches it
+  void Remove();
 
-  SharedGraphResult CreateSharedGraph(BasicGraph* g);
+  //attaches the segment of shmkey read-only, parameter is passed on to
+  //BasicGraph::AttachImage
+  SharedGraphResult LoadSharedGraph(key_t shmkey, const int parameter = 0);
+  //the same for a segment known by its id, one created with IPC_PRIVATE
+  SharedGraphResult AttachSharedGraph(int shmid, const int parameter = 0);
+
+  //publishes the views and mapping of graph selected by parameter in a new
+  //segment of shmkey, which stays attached here as GetGraph
+  SharedGraphResult CreateSharedGraph(const BasicGraph& graph, key_t shmkey, const int parameter = kALL);
 
  private:
-  
-  bool verbose_;
 
-  BasicGraph* graph_;
+  BasicGraph graph_;
 
   int shmid_;
 
-  auto shm_;
+  void *shm_;
+
+  HugePages pages_;
+
+  bool verbose_;
+
+};
+
+//the one word readers and the publisher of a versioned graph share
+struct SharedGraphControl{
+  char magic[8];
+  uint64_t current;  //version << 32 | id of its segment, 0 before the first version
+};
+
+//publishes version after version of a graph under one control key. every
+//version is an IPC_PRIVATE segment, the control word is flipped to it at once
+//and the segment it replaces is marked for removal: the kernel counts the
+//readers still attached to it and frees it when the last one moves on or exits
+class SharedGraphPublisher{
+
+ public:
+
+  explicit SharedGraphPublisher(key_t control_key, bool verbose=0)
+    :control_key_(control_key), control_id_(-1), control_(0), verbose_(verbose){}
+
+  ~SharedGraphPublisher();
+
+  //0 before the first Publish
+  uint32_t GetVersion() const;
 
-  bool set_;
+  //writes graph to a new segment and makes it the current version
+  SharedGraphResult Publish(const BasicGraph& graph, const int parameter = kALL);
 
-  bool created_by_me_;
+  //removes the current version and the control block, the readers keep
+  //the version they hold
+  void Remove();
+
+ private:
+
+  key_t control_key_;
+
+  int control_id_;
+
+  SharedGraphControl *control_;
+
+  bool verbose_;
+
+};
+
+//follows the versions of a SharedGraphPublisher. one reader serves one thread
+class SharedGraphReader{
+
+ public:
+
+  explicit SharedGraphReader(key_t control_key, const int parameter=0)
+    :control_key_(control_key), parameter_(parameter), control_(0), current_(0), version_(0){}
+
+  ~SharedGraphReader();
+
+  //0 until the first Refresh succeeds
+  const BasicGraph* GetGraph() const {
+    return graphs_[current_].GetGraph();
+  }
+
+  uint32_t GetVersion() const {
+    return version_;
+  }
+
+  //moves to the current version when it is not the one held, meant for
+  //query boundaries as the graph held before is detached. the version held
+  //stays when the new one cannot be attached
+  SharedGraphResult Refresh();
+
+ private:
+
+  key_t control_key_;
+
+  int parameter_;
+
+  const SharedGraphControl *control_;
+
+  //the version held and the spare the next one is attached to
+  SharedGraph graphs_[2];
+
+  int current_;
+
+  uint32_t version_;
+
+};
+
+//a graph published as a container image in a sealed memfd. the owner hands
+//the descriptor to its clients over a Unix domain socket and each of them
+//maps it read-only, nothing is copied. the memory lives as long as some
+//process holds the descriptor or a mapping of it, so nothing is left behind
+//when they exit, crashed or not
+class MemfdGraph{
+
+ public:
+
+  MemfdGraph(bool verbose=0)
+    :graph_(verbose), fd_(-1), image_(0), size_(0), pages_(kSmallPages), verbose_(verbose){}
+
+  ~MemfdGraph(){
+    Clear();
+  }
+
+  //read-only, 0 until a descriptor is attached
+  const BasicGraph* GetGraph() const {
+    return image_ ? &graph_ : 0;
+  }
+
+  HugePages GetHugePages() const {
+    return pages_;
+  }
+
+  int GetFd() const {
+    return fd_;
+  }
+
+  //unmaps the image and closes the descriptor
+  void Clear();
+
+  //writes the views and mapping of graph selected by parameter to a new memfd,
+  //which is sealed against writes and resizing and stays attached here
+  SharedGraphResult CreateSharedGraph(const BasicGraph& graph, const int parameter = kALL);
+  //maps fd read-only and takes it over, it is closed with the graph or when it
+  //is refused. a descriptor whose image could still change or shrink is.
+  //parameter is passed on to BasicGraph::AttachImage
+  SharedGraphResult AttachSharedGraph(int fd, const int parameter = 0);
+
+  //a Unix domain socket listening at path, a file left there by an earlier
+  //owner is replaced. -1 on failure
+  static int Listen(const std::string& path);
+  //accepts one client of listener and sends it the descriptor
+  SharedGraphResult Serve(int listener) const;
+  //the descriptor goes over a connected socket as SCM_RIGHTS
+  SharedGraphResult Send(int socket) const;
+  SharedGraphResult Receive(int socket, const int parameter = 0);
+  //connects to the owner listening at path and attaches what it sends
+  SharedGraphResult Connect(const std::string& path, const int parameter = 0);
+
+ private:
+
+  BasicGraph graph_;
+
+  int fd_;
+
+  void *image_;
+
+  size_t size_;
+
+  HugePages pages_;
+
+  bool verbose_;
 
 };
 
@@ -0,0 +1,116 @@
+#include "graph_text.h"
+#include <cstring>
+#include <algorithm>
+#include <cctype>
+
+size_t TextParser::ParseMatrixMarketHeader(const char *data, size_t length, const std::string& path, EdgeListInfo& info){
+  const char *end = data + length;
+  const char *banner_end = static_cast<const char*>( memchr(data, '\n', length) );
+  if (!banner_end)
+    banner_end = end;
+  std::string banner(data, banner_end);
+  std::transform(banner.begin(), banner.end(), banner.begin(), ::tolower);
+  if (banner.find("coordinate") == std::string::npos)
+    throw std::runtime_error("Only coordinate Matrix Market files are supported: " + path);
+  info.one_based = 1;
+  info.symmetric = banner.find("symmetric") != std::string::npos || banner.find("hermitian") != std::string::npos;
+  for(const char *p = banner_end; p < end; ){
+    p++;
+    const char *line_end = static_cast<const char*>( memchr(p, '\n', end - p) );
+    if (!line_end)
+      line_end = end;
+    long long size[3];
+    if (p < line_end && *p != '%' && ParseIntegers(p, line_end, size, 3) == 3){
+      if (size[0] < 0 || size[1] < 0)
+        throw std::runtime_error("Invalid size line in " + path);
+      info.number_vertex = std::max(size[0], size[1]);
+      return std::min<size_t>(line_end - data + 1, length);
+    }
+    p = line_end;
+  }
+  throw std::runtime_error("Missing size line in " + path);
+}
+
+template<class T>
+//ParseEdgeFile for either width of ids
+static EdgeListInfo ParseEdges(const std::string& path, std::vector<T>& sources, std::vector<T>& targets, bool verbose){
+  mProcess parse_process("Parallel parse of edge list " + path, 1, verbose);
+  parse_process.Start();
+  EdgeListInfo info;
+  MemoryBlock block = GraphMemory::MapFile(path, 0, 1);
+  const char *data = static_cast<const char*>(block.address);
+  size_t start = 0;
+  try{
+    if (TextParser::IsMatrixMarket(data, block.length))
+      start = TextParser::ParseMatrixMarketHeader(data, block.length, path, info);
+  }catch(std::runtime_error &e){
+    GraphMemory::Release(block);
+    throw;
+  }
+
+  std::vector<size_t> offsets;
+  TextParser::SplitLines(data + start, block.length - start, mParallel::Threads() * 4, offsets);
+  int chunks = offsets.size() - 1;
+  std::vector<long long> positions(chunks + 1, 0);
+  mParallel::For(0, chunks, [&](int thread_id, long long begin, long long end){
+      for(long long i = begin; i < end; i++)
+        positions[i+1] = TextParser::ParseEdgeLines<T>(data + start + offsets[i], data + start + offsets[i+1], 0, 0);
+    });
+  for(int i = 0; i < chunks; i++)
+    positions[i+1] += positions[i];
+  sources.resize(positions[chunks]);
+  targets.resize(positions[chunks]);
+  int shift = info.one_based ? 1 : 0;
+  mParallel::For(0, chunks, [&](int thread_id, long long begin, long long end){
+      for(long long i = begin; i < end; i++){
+        long long count = TextParser::ParseEdgeLines(data + start + offsets[i], data + start + offsets[i+1],
+                                         sources.data() + positions[i], targets.data() + positions[i]);
+        //negative ids stay negative, the smallest one would wrap around
+        for(long long j = positions[i]; j < positions[i] + count; j++){
+          sources[j] -= sources[j] >= 0 ? shift : 0;
+          targets[j] -= targets[j] >= 0 ? shift : 0;
+        }
+      }
+    });
+  GraphMemory::Release(block);
+
+  if (info.symmetric){
+    //only one triangle is stored, mirror the off-diagonal entries
+    long long size = sources.size();
+    sources.reserve(2 * size);
+    targets.reserve(2 * size);
+    for(long long i = 0; i < size; i++)
+      if (sources[i] != targets[i]){
+        sources.push_back(targets[i]);
+        targets.push_back(sources[i]);
+      }
+  }
+  parse_process.Stop();
+  return info;
+}
+
+EdgeListInfo TextParser::ParseEdgeFile(const std::string& path, std::vector<int>& sources, std::vector<int>& targets, bool verbose){
+  return ParseEdges(path, sources, targets, verbose);
+}
+
+EdgeListInfo TextParser::ParseEdgeFile(const std::string& path, std::vector<long long>& sources, std::vector<long long>& targets, bool verbose){
+  return ParseEdges(path, sources, targets, verbose);
+}
+
+void TextParser::SplitLines(const char *data, size_t length, int chunks, std::vector<size_t>& offsets){
+  offsets.assign(1, 0);
+  if (chunks < 1)
+    chunks = 1;
+  for(int i = 1; i < chunks; i++){
+    size_t offset = length / chunks * i;
+    if (offset <= offsets.back())
+      continue;
+    const char *newline = static_cast<const char*>( memchr(data + offset, '\n', length - offset) );
+    if (!newline)
+      break;
+    offset = newline - data + 1;
+    if (offset < length && offset > offsets.back())
+      offsets.push_back(offset);
+  }
+  offsets.push_back(length);
+}
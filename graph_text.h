@@ -0,0 +1,147 @@
+#ifndef GRAPH_TEXT_
+#define GRAPH_TEXT_
+
+#include "utility.h"
+#include "graph_memory.h"
+#include <string>
+#include <vector>
+#include <cstring>
+#include <limits>
+
+//what the header of an edge list told about it
+struct EdgeListInfo{
+
+EdgeListInfo(): number_vertex(-1), one_based(0), symmetric(0){}
+
+  long long number_vertex;  //-1 when only the edges tell
+  bool one_based;
+  bool symmetric;
+
+};
+
+//locale-free parsing of whitespace separated integers out of mapped text files
+class TextParser{
+
+ public:
+
+  static bool IsDigit(char c){ return static_cast<unsigned char>( c - '0' ) < 10; }
+
+  //number of integers in [begin, end)
+  static long long CountIntegers(const char *begin, const char *end){
+    long long count = 0;
+    bool in_number = 0;
+    for(const char *p = begin; p < end; p++){
+      bool digit = IsDigit(*p);
+      count += digit && !in_number;
+      in_number = digit;
+    }
+    return count;
+  }
+
+  //parses at most size integers of [begin, end) into array, returns how many were parsed.
+  //a number past the range of long long comes back as -1, the callers refuse it
+  template<class T>
+  static long long ParseIntegers(const char *begin, const char *end, T *array, long long size){
+    long long count = 0;
+    const char *p = begin;
+    while (count < size){
+      while (p < end && !IsDigit(*p))
+        p++;
+      if (p == end)
+        break;
+      bool negative = ( p > begin && p[-1] == '-' );
+      bool overflow = 0;
+      long long value = 0;
+      for(; p < end && IsDigit(*p); p++){
+        int digit = *p - '0';
+        overflow = overflow || value > ( std::numeric_limits<long long>::max() - digit ) / 10;
+        if (!overflow)
+          value = value * 10 + digit;
+      }
+      array[count++] = overflow ? static_cast<T>(-1) : static_cast<T>( negative ? -value : value );
+    }
+    return count;
+  }
+
+  //an id that T cannot hold comes back as -1, which the callers refuse as out
+  //of range instead of taking the id it wraps to
+  template<class T>
+  static T VertexId(long long value){
+    return static_cast<long long>( static_cast<T>(value) ) == value ? static_cast<T>(value) : -1;
+  }
+
+  //every line starting with two integers is an edge, blank lines and lines
+  //starting with # (SNAP) or % (Matrix Market) are skipped, further columns
+  //such as weights are ignored. with sources == 0 the edges are only counted
+  template<class T>
+  static long long ParseEdgeLines(const char *begin, const char *end, T *sources, T *targets){
+    long long count = 0;
+    for(const char *p = begin; p < end; ){
+      const char *line_end = static_cast<const char*>( memchr(p, '\n', end - p) );
+      if (!line_end)
+        line_end = end;
+      while (p < line_end && ( *p == ' ' || *p == '\t' || *p == '\r' ))
+        p++;
+      long long edge[2];
+      if (p < line_end && *p != '#' && *p != '%' && ParseIntegers(p, line_end, edge, 2) == 2){
+        if (sources){
+          sources[count] = VertexId<T>(edge[0]);
+          targets[count] = VertexId<T>(edge[1]);
+        }
+        count++;
+      }
+      p = line_end + 1;
+    }
+    return count;
+  }
+
+  static bool IsMatrixMarket(const char *data, size_t length){
+    static const char banner[] = "%%MatrixMarket";
+    return length >= sizeof(banner) - 1 && memcmp(data, banner, sizeof(banner) - 1) == 0;
+  }
+
+  //parses the banner and the size line of a Matrix Market file, returns where the entries start
+  static size_t ParseMatrixMarketHeader(const char *data, size_t length, const std::string& path, EdgeListInfo& info);
+
+  //reads a plain, SNAP or Matrix Market edge list with all threads,
+  //vertex ids come back zero based
+  static EdgeListInfo ParseEdgeFile(const std::string& path, std::vector<int>& sources, std::vector<int>& targets, bool verbose);
+  static EdgeListInfo ParseEdgeFile(const std::string& path, std::vector<long long>& sources, std::vector<long long>& targets, bool verbose);
+
+  //offsets of at most chunks pieces of data, each piece but the last ends right after a newline
+  static void SplitLines(const char *data, size_t length, int chunks, std::vector<size_t>& offsets);
+
+  //reads the first size integers of a text file with all threads
+  template<class T>
+  static void ParseFile(const std::string& path, long long size, T *array, bool verbose){
+    mProcess parse_process("Parallel parse of text file " + path, 1, verbose);
+    parse_process.Start();
+    MemoryBlock block = GraphMemory::MapFile(path, 0, 1);
+    const char *data = static_cast<const char*>(block.address);
+    std::vector<size_t> offsets;
+    SplitLines(data, block.length, mParallel::Threads() * 4, offsets);
+    int chunks = offsets.size() - 1;
+
+    //first pass finds where the numbers of every chunk go, second pass writes them
+    std::vector<long long> positions(chunks + 1, 0);
+    mParallel::For(0, chunks, [&](int thread_id, long long begin, long long end){
+        for(long long i = begin; i < end; i++)
+          positions[i+1] = CountIntegers(data + offsets[i], data + offsets[i+1]);
+      });
+    for(int i = 0; i < chunks; i++)
+      positions[i+1] += positions[i];
+    if (positions[chunks] < size){
+      GraphMemory::Release(block);
+      throw std::runtime_error("Truncated text file " + path);
+    }
+    mParallel::For(0, chunks, [&](int thread_id, long long begin, long long end){
+        for(long long i = begin; i < end && positions[i] < size; i++)
+          ParseIntegers(data + offsets[i], data + offsets[i+1], array + positions[i], size - positions[i]);
+      });
+    GraphMemory::Release(block);
+    parse_process.Stop();
+  }
+
+};
+
+#endif
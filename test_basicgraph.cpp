@@ -1,9 +1,21 @@
 #include "basic_graph.h"
+#include "graph_external.h"
+#include "graph_share.h"
+#include "graph_text.h"
 #include <algorithm>
+#include <climits>
+#include <cmath>
 #include <iostream>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <sstream>
+#include <thread>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
 using namespace std;
 #define TERMINATE(x) {cout<<"Wrong in Case "<<t<<": "<<x<<endl; exit(0);}
 
@@ -38,7 +50,7 @@ void TestImpl(int t, string name, vector<vector<int> > &edge){
   }
   for(int i=0; i<n; i++){
     vector<int> neighbor;
-    for(int j=0, x; j!=edge[i].size(); i++){
+    for(int j=0, x; j!=edge[i].size(); j++){
       tar_stream>>x;
       neighbor.push_back(x);
     }
@@ -50,6 +62,171 @@ void TestImpl(int t, string name, vector<vector<int> > &edge){
   }
 }
 
+void TestGraph(int t, string name, const BasicGraph &g, GraphType type, vector<vector<int> > &edge){
+  if (g.GetNumberVertex() != edge.size()){
+    TERMINATE("Wrong number of vertices in "+name);
+  }
+  for(int i=0; i<g.GetNumberVertex(); i++){
+    vector<int> neighbor=g.GetNeighbors(i, type);
+    sort(neighbor.begin(), neighbor.end());
+    if (neighbor != edge[i]){
+      TERMINATE("Wrong neighbors for node "+ItoA(i)+" of type "+CONVERT_TO_STRING(type)+" in "+name);
+    }
+  }
+}
+
+//the segments of the running case, removed by exit too so that a failing
+//case leaves none behind
+SharedGraph *created_segment=0;
+SharedGraphPublisher *created_publisher=0;
+
+void RemoveSegments(){
+  if (created_segment)
+    created_segment->Remove();
+  if (created_publisher)
+    created_publisher->Remove();
+}
+
+//sends count descriptors in one message, as a misbehaving peer would
+void SendDescriptors(int socket, const int *fds, int count){
+  char byte=0;
+  struct iovec data = { &byte, 1 };
+  vector<char> control(CMSG_SPACE(sizeof(int) * count), 0);
+  struct msghdr message;
+  memset(&message, 0, sizeof(message));
+  message.msg_iov=&data;
+  message.msg_iovlen=1;
+  message.msg_control=&control[0];
+  message.msg_controllen=control.size();
+  struct cmsghdr *header=CMSG_FIRSTHDR(&message);
+  header->cmsg_level=SOL_SOCKET;
+  header->cmsg_type=SCM_RIGHTS;
+  header->cmsg_len=CMSG_LEN(sizeof(int) * count);
+  memcpy(CMSG_DATA(header), fds, sizeof(int) * count);
+  sendmsg(socket, &message, 0);
+}
+
+int OpenDescriptors(){
+  int count=0;
+  DIR *directory=opendir("/proc/self/fd");
+  while (readdir(directory))
+    count++;
+  closedir(directory);
+  return count;
+}
+
+bool SameGraph(const BasicGraph &g, const BasicGraph &h){
+  if (g.GetNumberVertex() != h.GetNumberVertex() || g.GetNumerEdges() != h.GetNumerEdges())
+    return 0;
+  for(int i=0; i<g.GetNumberVertex(); i++)
+    if (g.GetNeighbors(i) != h.GetNeighbors(i))
+      return 0;
+  return 1;
+}
+
+//every list sorted, without duplicates and, unless loops are allowed, self-loops
+bool CleanGraph(const BasicGraph &g, bool loops){
+  for(int i=0; i<g.GetNumberVertex(); i++){
+    vector<int> neighbor=g.GetNeighbors(i);
+    for(size_t j=0; j<neighbor.size(); j++)
+      if (( j && neighbor[j-1] >= neighbor[j] ) || ( !loops && neighbor[j] == i ))
+        return 0;
+  }
+  return 1;
+}
+
+//every edge of an undirected generator comes out in both directions
+bool SymmetricGraph(const BasicGraph &g){
+  for(int i=0; i<g.GetNumberVertex(); i++)
+    for(auto j: g.GetNeighbors(i)){
+      vector<int> back=g.GetNeighbors(j);
+      if (!binary_search(back.begin(), back.end(), i))
+        return 0;
+    }
+  return 1;
+}
+
+//the runs an ExternalGraphBuilder of this process left in the working directory
+int LeftRuns(){
+  int count=0;
+  string prefix="hk_run_"+ItoA(getpid())+"_";
+  DIR *directory=opendir(".");
+  while (struct dirent *entry=readdir(directory))
+    count+=string(entry->d_name).compare(0, prefix.size(), prefix) == 0;
+  closedir(directory);
+  return count;
+}
+
+//the lists of view type read through DecodeNeighbors and through GetNeighborIterator
+bool DecodedGraph(const BasicGraph &g, GraphType type, vector<vector<int> > &edge){
+  for(int i=0; i<g.GetNumberVertex(); i++){
+    vector<int> decoded(g.GetDegree(i, type)), iterated;
+    if (g.DecodeNeighbors(i, decoded.data(), type) != static_cast<int>(edge[i].size()))
+      return 0;
+    for(NeighborIterator it=g.GetNeighborIterator(i, type); it.HasNext(); )
+      iterated.push_back(it.Next());
+    if (decoded != iterated)
+      return 0;
+    sort(decoded.begin(), decoded.end());
+    if (decoded != edge[i])
+      return 0;
+  }
+  return 1;
+}
+
+//IN of g against a transpose of OUT built list by list, both in source order
+bool TransposedGraph(const BasicGraph &g){
+  vector<vector<int> > transposed(g.GetNumberVertex());
+  for(int i=0; i<g.GetNumberVertex(); i++)
+    for(auto j: g.GetNeighbors(i, OUT))
+      transposed[j].push_back(i);
+  for(int i=0; i<g.GetNumberVertex(); i++)
+    if (g.GetNeighbors(i, IN) != transposed[i])
+      return 0;
+  return g.IsSorted(IN);
+}
+
+//the lists of a relabeled view mapped back through the raw ids, against
+//the lists of the raw graph
+bool RawGraph(const BasicGraph &g, GraphType type, vector<vector<int> > &edge){
+  if (g.GetNumberVertex() != static_cast<int>(edge.size()))
+    return 0;
+  vector<bool> seen(edge.size());
+  for(int i=0; i<g.GetNumberVertex(); i++){
+    long long raw_id=g.ToRawId(i);
+    if (raw_id<0 || raw_id>=static_cast<long long>(edge.size()) || seen[raw_id] || g.FromRawId(raw_id) != i)
+      return 0;
+    seen[raw_id]=1;
+    vector<long long> raw_neighbor=g.ToRawIds(g.GetNeighbors(i, type));
+    vector<int> neighbor(raw_neighbor.begin(), raw_neighbor.end());
+    sort(neighbor.begin(), neighbor.end());
+    if (neighbor != edge[raw_id])
+      return 0;
+  }
+  return 1;
+}
+
+bool Refused(vector<char> image){
+  BasicGraph g(0);
+  try{
+    g.AttachImage(&image[0], image.size());
+  }catch(runtime_error &e){
+    return 1;
+  }
+  return 0;
+}
+
+bool EdgeListRefused(const string& path, const string& text, int parameter=0){
+  ofstream(path.c_str())<<text;
+  BasicGraph g(0);
+  try{
+    g.LoadEdgeList(path, parameter);
+  }catch(runtime_error &e){
+    return 1;
+  }
+  return 0;
+}
+
 void Test(int t){
   mProcess test_process("Testing "+ItoA(t)+"th case", 1, 1);
   test_process.Start();
@@ -122,14 +299,848 @@ void Test(int t){
   TestImpl(t,name+".imp_union",edge_union);
   //
 
+  //check Container
+  my_g.Save(name, kALL+kContainer);
+  //two threads publishing the same path each write their own temporary file
+  thread other_save([&](){ my_g.Save(name, kALL+kContainer+kOverwrite); });
+  my_g.Save(name, kALL+kContainer+kOverwrite);
+  other_save.join();
+  BasicGraph container_g(0);
+  container_g.Load(name, kMapped+kVerify);
+  TestGraph(t, name+kContainerSuffix, container_g, OUT, edge);
+  TestGraph(t, name+kContainerSuffix, container_g, IN, edge_in);
+  TestGraph(t, name+kContainerSuffix, container_g, INTERSECTION, edge_inter);
+  TestGraph(t, name+kContainerSuffix, container_g, UNION, edge_union);
+  for(int type=OUT; type<BAD; type++)
+    if (!container_g.IsSorted(static_cast<GraphType>(type))){
+      TERMINATE("Unsorted "+CONVERT_TO_STRING(static_cast<GraphType>(type))+" lists in "+name+kContainerSuffix);
+    }
+  //
+
+  //check that images whose sections disagree are refused
+  vector<char> image(container_g.ImageSize());
+  container_g.WriteImage(&image[0]);
+  vector<char> corrupted(image);
+  reinterpret_cast<GraphFileHeader*>(&corrupted[0])->number_vertex++;
+  if (!Refused(corrupted)){
+    TERMINATE("An image with a wrong vertex count was attached");
+  }
+  //the first two sections are the boundaries and the targets of OUT
+  corrupted = image;
+  GraphSection *targets = reinterpret_cast<GraphSection*>(&corrupted[0] + sizeof(GraphFileHeader)) + 1;
+  if (targets->count){
+    targets->count--;
+    targets->length -= sizeof(int);
+    if (!Refused(corrupted)){
+      TERMINATE("An image with truncated targets was attached");
+    }
+  }
+  //
+
+  //check edge lists in every format. the plain lists end with the self-loop
+  //n-1 n-1, which fixes the vertex count and is dropped by kNoSelfLoops, and
+  //repeat their first edge for kDeduplicate
+  ofstream plain_stream(name+".plain"), snap_stream(name+".snap"), mtx_stream(name+".mtx");
+  snap_stream<<"# Directed graph: "<<name<<endl<<"# FromNodeId\tToNodeId"<<endl;
+  int upper=0;
+  for(int i=0; i<n; i++){
+    for(auto j: edge[i]){
+      plain_stream<<i<<" "<<j<<" 1.5"<<endl;
+      snap_stream<<i<<"\t"<<j<<"\r"<<endl;
+    }
+    for(auto j: edge_union[i])
+      upper+=i<j;
+  }
+  for(int i=0; i<n; i++)
+    if (!edge[i].empty()){
+      plain_stream<<endl<<i<<" "<<edge[i][0]<<endl;
+      break;
+    }
+  plain_stream<<n-1<<" "<<n-1<<endl;
+  snap_stream<<n-1<<"\t"<<n-1<<endl;
+  //a symmetric Matrix Market file stores one triangle, one-based
+  mtx_stream<<"%%MatrixMarket matrix coordinate pattern symmetric"<<endl<<"% "<<name<<endl<<n<<" "<<n<<" "<<upper<<endl;
+  for(int i=0; i<n; i++)
+    for(auto j: edge_union[i])
+      if (i<j)
+        mtx_stream<<j+1<<" "<<i+1<<endl;
+  plain_stream.close();
+  snap_stream.close();
+  mtx_stream.close();
+  BasicGraph edge_list_g(0);
+  edge_list_g.LoadEdgeList(name+".plain", kDeduplicate+kNoSelfLoops);
+  TestGraph(t, name+".plain", edge_list_g, OUT, edge);
+  TestGraph(t, name+".plain", edge_list_g, IN, edge_in);
+  edge_list_g.LoadEdgeList(name+".snap", kNoSelfLoops);
+  TestGraph(t, name+".snap", edge_list_g, OUT, edge);
+  edge_list_g.LoadEdgeList(name+".snap");
+  vector<int> last_neighbor=edge_list_g.GetNeighbors(n-1);
+  if (edge_list_g.GetNumerEdges() != m + 1 || !binary_search(last_neighbor.begin(), last_neighbor.end(), n-1)){
+    TERMINATE("A self-loop was dropped without kNoSelfLoops in "+name+".snap");
+  }
+  edge_list_g.LoadEdgeList(name+".mtx");
+  TestGraph(t, name+".mtx", edge_list_g, OUT, edge_union);
+  //lists without an edge, the header alone tells the vertices
+  ofstream(name+".empty")<<"# no edges"<<endl<<endl;
+  edge_list_g.LoadEdgeList(name+".empty");
+  if (edge_list_g.GetNumberVertex() != 0 || edge_list_g.GetNumerEdges() != 0){
+    TERMINATE("Wrong graph of an edge list without edges");
+  }
+  ofstream(name+".empty")<<"%%MatrixMarket matrix coordinate pattern general"<<endl<<"3 3 0"<<endl;
+  edge_list_g.LoadEdgeList(name+".empty");
+  vector<vector<int> > no_edge(3);
+  TestGraph(t, name+".empty", edge_list_g, OUT, no_edge);
+  TestGraph(t, name+".empty", edge_list_g, IN, no_edge);
+  //
+
+  //check 64-bit offsets through every way a view is built, stored and read
+  BasicGraph wide_g(0);
+  wide_g.LoadEdgeList(name+".plain", kDeduplicate+kNoSelfLoops+kWideOffsets);
+  if (!wide_g.HasWideOffsets(OUT)){
+    TERMINATE("kWideOffsets left the offsets of an edge list 32-bit");
+  }
+  TestGraph(t, name+".wide", wide_g, OUT, edge);
+  TestGraph(t, name+".wide", wide_g, IN, edge_in);
+  TestGraph(t, name+".wide", wide_g, INTERSECTION, edge_inter);
+  TestGraph(t, name+".wide", wide_g, UNION, edge_union);
+  if (!wide_g.HasWideOffsets(IN) || !wide_g.HasWideOffsets(UNION)){
+    TERMINATE("Views derived from 64-bit offsets came out 32-bit");
+  }
+  BasicGraph wide_loaded_g(0);
+  wide_g.Save(name+".wide_bin", kALL);
+  wide_loaded_g.Load(name+".wide_bin");
+  TestGraph(t, name+".wide_bin", wide_loaded_g, OUT, edge);
+  TestGraph(t, name+".wide_bin", wide_loaded_g, IN, edge_in);
+  if (!wide_loaded_g.HasWideOffsets(OUT) || !wide_loaded_g.HasWideOffsets(IN)){
+    TERMINATE("Binary files lost the 64-bit offsets");
+  }
+  wide_g.Save(name+".wide", kALL+kContainer);
+  wide_loaded_g.Load(name+".wide");
+  TestGraph(t, name+".wide"+kContainerSuffix, wide_loaded_g, OUT, edge);
+  TestGraph(t, name+".wide"+kContainerSuffix, wide_loaded_g, INTERSECTION, edge_inter);
+  if (!wide_loaded_g.HasWideOffsets(OUT)){
+    TERMINATE("A container lost the 64-bit offsets");
+  }
+  //text files hold no width, the edge count or kWideOffsets pick it
+  wide_g.Save(name+".wide_text", kIndex+kOut);
+  wide_loaded_g.Load(name+".wide_text");
+  TestGraph(t, name+".wide_text", wide_loaded_g, OUT, edge);
+  if (wide_loaded_g.HasWideOffsets(OUT)){
+    TERMINATE("Text files of few edges were read with 64-bit offsets");
+  }
+  wide_loaded_g.Load(name+".wide_text", kWideOffsets);
+  TestGraph(t, name+".wide_text", wide_loaded_g, OUT, edge);
+  if (!wide_loaded_g.HasWideOffsets(OUT)){
+    TERMINATE("kWideOffsets left the offsets of text files 32-bit");
+  }
+  wide_g.Compress(OUT);
+  if (!DecodedGraph(wide_g, OUT, edge)){
+    TERMINATE("Wrong decoded lists of compressed 64-bit offsets");
+  }
+  wide_g.Decompress(OUT);
+  wide_g.Reorder(kRCMOrder);
+  for(int i=0; i<n; i++){
+    vector<long long> raw_neighbor=wide_g.ToRawIds(wide_g.GetNeighbors(i, OUT));
+    vector<int> neighbor(raw_neighbor.begin(), raw_neighbor.end());
+    sort(neighbor.begin(), neighbor.end());
+    if (neighbor != edge[wide_g.ToRawId(i)]){
+      TERMINATE("Wrong neighbors for raw node "+ItoA(wide_g.ToRawId(i))+" of 64-bit offsets after reordering");
+    }
+  }
+  if (!wide_g.HasWideOffsets(OUT)){
+    TERMINATE("Reordering narrowed 64-bit offsets");
+  }
+  wide_g.Canonicalize(OUT, kDeduplicate+kWideOffsets);
+  if (!wide_g.HasWideOffsets(OUT)){
+    TERMINATE("Canonicalize with kWideOffsets narrowed the offsets");
+  }
+  wide_g.Canonicalize(OUT, kDeduplicate);
+  if (wide_g.HasWideOffsets(OUT)){
+    TERMINATE("Canonicalize kept 64-bit offsets few edges do not need");
+  }
+  //
+
+  //check undirected graphs through every store, only the symmetric OUT is kept
+  BasicGraph undirected_g(0), undirected_loaded_g(0);
+  undirected_g.LoadEdgeList(name+".plain", kUndirected+kNoSelfLoops);
+  if (!undirected_g.IsUndirected() || undirected_g.GetNumerEdges() != 2*upper){
+    TERMINATE("Wrong undirected edge list "+name+".plain");
+  }
+  TestGraph(t, name+".undirected", undirected_g, OUT, edge_union);
+  TestGraph(t, name+".undirected", undirected_g, IN, edge_union);
+  TestGraph(t, name+".undirected", undirected_g, INTERSECTION, edge_union);
+  undirected_g.Save(name+".undirected", kALL);
+  undirected_g.Save(name+".undirected_text", kIndex+kOut+kIn+kIntersect+kUnion);
+  undirected_g.Save(name+".undirected", kALL+kContainer);
+  if (FilePath::Exist(name+".undirected.imp_in_bin.ind") || FilePath::Exist(name+".undirected_text.imp_union.ind")){
+    TERMINATE("Views other than OUT were saved for an undirected graph");
+  }
+  string undirected_names[]={name+".undirected_text", name+".undirected"};
+  for(int i=0; i<2; i++){
+    undirected_loaded_g.Load(undirected_names[i]);
+    if (!undirected_loaded_g.IsUndirected() || undirected_loaded_g.GetNumerEdges() != 2*upper){
+      TERMINATE("An undirected graph was loaded directed from "+undirected_names[i]);
+    }
+    TestGraph(t, undirected_names[i], undirected_loaded_g, UNION, edge_union);
+    TestGraph(t, undirected_names[i], undirected_loaded_g, IN, edge_union);
+  }
+  remove((name+".undirected"+kContainerSuffix).c_str());
+  undirected_loaded_g.Load(name+".undirected", kMapped);
+  if (!undirected_loaded_g.IsUndirected()){
+    TERMINATE("An undirected graph was loaded directed from binary files");
+  }
+  TestGraph(t, name+".undirected_bin", undirected_loaded_g, INTERSECTION, edge_union);
+  //a directed graph made undirected matches the one loaded that way
+  BasicGraph symmetrized_g(0);
+  symmetrized_g.LoadEdgeList(name+".plain", kDeduplicate+kNoSelfLoops);
+  symmetrized_g.Symmetrize();
+  if (!symmetrized_g.IsUndirected() || !SameGraph(symmetrized_g, undirected_g)){
+    TERMINATE("Wrong symmetrized graph");
+  }
+  //
+
+  //check external builds. the symmetric list is added over and over with the
+  //smallest budget, so that several runs are merged and the copies dropped
+  {
+    ExternalGraphBuilder builder(".", 0, kDeduplicate+kNoSelfLoops);
+    builder.AddEdgeList(name+".mtx");
+    for(int round=0; 2LL*upper*round<3*4096 && upper; round++)
+      for(int i=0; i<n; i++){
+        builder.AddEdge(i, i);
+        for(auto j: edge_union[i])
+          builder.AddEdge(i, j);
+      }
+    builder.Build(name+".external");
+  }
+  BasicGraph external_g(0);
+  external_g.Load(name+".external");
+  TestGraph(t, name+".external", external_g, OUT, edge_union);
+  TestGraph(t, name+".external", external_g, IN, edge_union);
+  //a directed build keeps its self-loop and only replaces files with kOverwrite
+  bool replaced=0;
+  try{
+    ExternalGraphBuilder builder(".", 0);
+    builder.AddEdge(0, 0);
+    builder.Build(name+".external");
+    replaced=1;
+  }catch(runtime_error &e){
+  }
+  if (replaced){
+    TERMINATE("An external build replaced files without kOverwrite");
+  }
+  {
+    ExternalGraphBuilder builder(".", 0, kOverwrite);
+    for(int i=0; i<n; i++)
+      for(auto j: edge[i])
+        builder.AddEdge(i, j);
+    builder.AddEdge(n-1, n-1);
+    builder.Build(name+".external");
+  }
+  vector<vector<int> > edge_loop(edge), edge_in_loop(edge_in);
+  edge_loop[n-1].push_back(n-1);
+  edge_in_loop[n-1].push_back(n-1);
+  external_g.Load(name+".external");
+  TestGraph(t, name+".external", external_g, OUT, edge_loop);
+  TestGraph(t, name+".external", external_g, IN, edge_in_loop);
+  //a header of more vertices than an int holds is refused, not wrapped
+  ofstream(name+".large")<<"%%MatrixMarket matrix coordinate pattern general"<<endl<<"4294967297 4294967297 1"<<endl<<"1 2"<<endl;
+  bool large_built=0;
+  try{
+    ExternalGraphBuilder builder(".", 0, kOverwrite);
+    builder.AddEdgeList(name+".large");
+    builder.Build(name+".large");
+    large_built=1;
+  }catch(runtime_error &e){
+  }
+  if (large_built){
+    TERMINATE("An external build took a vertex count past INT_MAX");
+  }
+  if (LeftRuns()){
+    TERMINATE("Runs of an external build were left behind");
+  }
+  //
+
+  //check a graph published in a SysV segment
+  key_t shm_key=getpid() * 4 + 1;
+  SharedGraph owner_g;
+  created_segment=&owner_g;
+  if (owner_g.CreateSharedGraph(container_g, shm_key) != SharingDone){
+    TERMINATE("Failed to create a shared graph");
+  }
+  SharedGraph shared_g;
+  if (shared_g.LoadSharedGraph(shm_key) != SharingDone){
+    TERMINATE("Failed to load a shared graph");
+  }
+  TestGraph(t, "shared", *shared_g.GetGraph(), OUT, edge);
+  TestGraph(t, "shared", *shared_g.GetGraph(), IN, edge_in);
+  TestGraph(t, "shared", *shared_g.GetGraph(), UNION, edge_union);
+  //a key already taken is refused and the segment held is still removed below
+  if (owner_g.CreateSharedGraph(container_g, shm_key) != WritingWrongKey){
+    TERMINATE("A shared graph was created twice under one key");
+  }
+  //a reader that failed to attach a segment has nothing to remove
+  int garbage_id=shmget(IPC_PRIVATE, 4096, IPC_CREAT | 0600);
+  SharedGraph garbage_g;
+  bool garbage_attached=garbage_g.AttachSharedGraph(garbage_id) != LoadingWrongImage;
+  garbage_g.Remove();
+  struct shmid_ds garbage_status;
+  bool garbage_removed=shmctl(garbage_id, IPC_STAT, &garbage_status) < 0;
+  shmctl(garbage_id, IPC_RMID, 0);
+  if (garbage_attached || garbage_removed){
+    TERMINATE("A reader that failed to attach a segment removed it");
+  }
+  shared_g.Clear();
+  owner_g.Remove();
+  created_segment=0;
+  if (shared_g.LoadSharedGraph(shm_key) != LoadingWrongKey){
+    TERMINATE("A removed shared graph was loaded");
+  }
+  //
+
+  //check versions of a published graph, a reader keeps the version it holds
+  //until it refreshes
+  SharedGraphPublisher publisher(getpid() * 4 + 2);
+  created_publisher=&publisher;
+  SharedGraphReader old_reader(getpid() * 4 + 2), new_reader(getpid() * 4 + 2);
+  if (old_reader.Refresh() != LoadingWrongKey){
+    TERMINATE("A version was read before the first one was published");
+  }
+  if (publisher.Publish(container_g) != SharingDone || old_reader.Refresh() != SharingDone){
+    TERMINATE("Failed to publish the first version");
+  }
+  uint32_t first_version=old_reader.GetVersion();
+  if (publisher.Publish(container_g) != SharingDone || new_reader.Refresh() != SharingDone){
+    TERMINATE("Failed to publish the second version");
+  }
+  if (new_reader.GetVersion() == first_version || new_reader.GetVersion() != publisher.GetVersion() ||
+      old_reader.GetVersion() != first_version){
+    TERMINATE("Wrong versions of a published graph");
+  }
+  TestGraph(t, "published", *old_reader.GetGraph(), UNION, edge_union);
+  TestGraph(t, "published", *new_reader.GetGraph(), IN, edge_in);
+  if (old_reader.Refresh() != SharingDone || old_reader.GetVersion() != publisher.GetVersion()){
+    TERMINATE("A reader did not move to the current version");
+  }
+  TestGraph(t, "published", *old_reader.GetGraph(), OUT, edge);
+  publisher.Remove();
+  created_publisher=0;
+  SharedGraphReader late_reader(getpid() * 4 + 2);
+  if (late_reader.Refresh() != LoadingWrongKey){
+    TERMINATE("A removed published graph was read");
+  }
+  TestGraph(t, "published", *new_reader.GetGraph(), OUT, edge);
+  //
+
+  //check a sealed memfd graph handed over a socket
+  MemfdGraph memfd_owner_g, memfd_g;
+  if (memfd_owner_g.CreateSharedGraph(container_g) != SharingDone){
+    TERMINATE("Failed to create a memfd graph");
+  }
+  int memfd_sockets[2];
+  socketpair(AF_UNIX, SOCK_STREAM, 0, memfd_sockets);
+  if (memfd_owner_g.Send(memfd_sockets[0]) != SharingDone || memfd_g.Receive(memfd_sockets[1]) != SharingDone){
+    TERMINATE("Failed to hand over a memfd graph");
+  }
+  close(memfd_sockets[0]);
+  close(memfd_sockets[1]);
+  int seals=fcntl(memfd_g.GetFd(), F_GET_SEALS);
+  if (seals<0 || ( seals & ( F_SEAL_WRITE | F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL ) ) != ( F_SEAL_WRITE | F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL ) ||
+      write(memfd_g.GetFd(), "x", 1) == 1){
+    TERMINATE("A memfd graph was handed over unsealed");
+  }
+  TestGraph(t, "memfd", *memfd_g.GetGraph(), OUT, edge);
+  TestGraph(t, "memfd", *memfd_g.GetGraph(), INTERSECTION, edge_inter);
+  //the same image without seals could change under its readers
+  int unsealed=memfd_create("unsealed", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+  if (write(unsealed, &image[0], image.size()) != static_cast<ssize_t>(image.size())){
+    TERMINATE("Failed to write an unsealed memfd");
+  }
+  MemfdGraph unsealed_g;
+  if (unsealed_g.AttachSharedGraph(unsealed) != LoadingWrongSeals || unsealed_g.GetGraph()){
+    TERMINATE("An unsealed memfd graph was attached");
+  }
+  //
+
+  //check every page policy: large blocks come zeroed, aligned to their pages
+  //and never on pages larger than themselves, small ones stay on the heap, and
+  //a graph built under a policy has the same lists as one on small pages
+  HugePages saved_policy=GraphMemory::GetHugePages();
+  HugePages policies[]={kSmallPages, kTransparentHugePages, kHugePages2MB, kHugePages1GB};
+  BasicGraph small_pages_g(0);
+  small_pages_g.GenerateErdosRenyiGraph(20000, 800000, t);
+  for(int i=0; i<4; i++){
+    GraphMemory::SetHugePages(policies[i]);
+    size_t length=( 4 << 20 ) + t;
+    MemoryBlock block=GraphMemory::Allocate(length), small_block=GraphMemory::Allocate(4096);
+    const char *bytes=static_cast<const char*>(block.address);
+    bool zeroed=block.length >= length && count(bytes, bytes + length, 0) == static_cast<long>(length);
+    memset(block.address, 0xff, length);
+    bool huge_aligned=block.kind != kAnonymousMemory || reinterpret_cast<uintptr_t>(block.address) % ( 2 << 20 ) == 0;
+    bool pages=policies[i] == kSmallPages ? block.kind == kHeapMemory && block.pages == kSmallPages : block.pages != kHugePages1GB;
+    bool small_heap=small_block.kind == kHeapMemory && small_block.pages == kSmallPages;
+    GraphMemory::Release(block);
+    GraphMemory::Release(small_block);
+    if (!zeroed || !huge_aligned || !pages || !small_heap){
+      GraphMemory::SetHugePages(saved_policy);
+      TERMINATE("Wrong block under page policy "+string(GraphMemory::Describe(policies[i])));
+    }
+    BasicGraph policy_g(0);
+    policy_g.GenerateErdosRenyiGraph(20000, 800000, t);
+    bool same=SameGraph(policy_g, small_pages_g) && policy_g.GetHugePages(OUT) != kHugePages1GB &&
+      ( policies[i] != kSmallPages || policy_g.GetHugePages(OUT) == kSmallPages );
+    GraphMemory::SetHugePages(saved_policy);
+    if (!same){
+      TERMINATE("Wrong graph under page policy "+string(GraphMemory::Describe(policies[i])));
+    }
+  }
+  //
+
+  //check that only blocks of a whole 1 GiB page or more take 1 GiB pages
+  if (GraphMemory::ExplicitPages(64 << 20, kHugePages1GB) != kHugePages2MB ||
+      GraphMemory::ExplicitPages(1 << 30, kHugePages1GB) != kHugePages1GB ||
+      GraphMemory::ExplicitPages(1 << 20, kHugePages1GB) != kSmallPages ||
+      GraphMemory::ExplicitPages(64 << 20, kTransparentHugePages) != kSmallPages){
+    TERMINATE("Wrong explicit huge pages of a block");
+  }
+  //
+
+  //check NUMA placements, on virtual nodes past those of the machine
+  container_g.PlaceOnNodes(kNumaReplicate, 3);
+  TestGraph(t, name+kContainerSuffix, container_g, UNION, edge_union);
+  if (!DecodedGraph(container_g, UNION, edge_union)){
+    TERMINATE("Wrong decoded lists of replicated UNION");
+  }
+  container_g.PlaceOnNodes(kNumaPartition, 3);
+  TestGraph(t, name+kContainerSuffix, container_g, IN, edge_in);
+  if (container_g.GetVertexNode(0) != 0 || container_g.GetVertexNode(n-1) >= container_g.GetNumaNodes()){
+    TERMINATE("Wrong owner nodes of partitioned graph");
+  }
+  container_g.Compress(OUT);
+  if (container_g.GetNumaPlacement() != kNumaFirstTouch || container_g.GetVertexNode(n-1) != 0){
+    TERMINATE("Compression kept the placement of a partitioned graph");
+  }
+  TestGraph(t, name+kContainerSuffix, container_g, IN, edge_in);
+  //every placement on 1 to 4 nodes keeps the lists of every view, read from
+  //several threads at once. a partition cuts the vertices into ranges in
+  //order, each of about the same number of OUT edges
+  BasicGraph placed_g(0);
+  placed_g.GenerateBarabasiAlbertGraph(20000, 8, t, kDeduplicate+kNoSelfLoops);
+  placed_g.MaterializeViews();
+  vector<vector<int> > placed_edge[BAD];
+  for(int type=OUT; type<BAD; type++)
+    for(int i=0; i<placed_g.GetNumberVertex(); i++)
+      placed_edge[type].push_back(placed_g.GetNeighbors(i, static_cast<GraphType>(type)));
+  int max_degree=0;
+  for(int i=0; i<placed_g.GetNumberVertex(); i++)
+    max_degree=max(max_degree, placed_g.GetDegree(i));
+  NumaPlacement placements[]={kNumaInterleave, kNumaReplicate, kNumaPartition};
+  for(int p=0; p<3; p++)
+    for(int nodes=1; nodes<=4; nodes++){
+      placed_g.PlaceOnNodes(placements[p], nodes);
+      if (placed_g.GetNumaPlacement() != placements[p] || placed_g.GetNumaNodes() != nodes){
+        TERMINATE("Wrong placement reported on "+ItoA(nodes)+" nodes");
+      }
+      vector<long long> node_edges(nodes, 0);
+      for(int i=0, last=0; i<placed_g.GetNumberVertex(); i++){
+        int node=placed_g.GetVertexNode(i);
+        if (node<last || node>=nodes || ( placements[p] != kNumaPartition && node )){
+          TERMINATE("Wrong owner node of node "+ItoA(i)+" on "+ItoA(nodes)+" nodes");
+        }
+        node_edges[node]+=placed_g.GetDegree(i);
+        last=node;
+      }
+      for(int k=0; placements[p] == kNumaPartition && k<nodes; k++)
+        if (node_edges[k] > placed_g.GetNumerEdges() / nodes + max_degree){
+          TERMINATE("Unbalanced range of node "+ItoA(k)+" of "+ItoA(nodes));
+        }
+      vector<int> read_right(4, 1);
+      vector<thread> readers;
+      for(int r=0; r<4; r++)
+        readers.push_back(thread([&, r](){
+              for(int type=OUT; type<BAD; type++){
+                GraphType view=static_cast<GraphType>(type);
+                for(int i=r; i<placed_g.GetNumberVertex(); i+=4){
+                  vector<int> decoded(placed_g.GetDegree(i, view));
+                  placed_g.DecodeNeighbors(i, decoded.data(), view);
+                  if (placed_g.GetNeighbors(i, view) != placed_edge[type][i] || decoded != placed_edge[type][i] ||
+                      !placed_g.HasEdge(i, placed_edge[type][i].empty() ? i : placed_edge[type][i][0], view) !=
+                      placed_edge[type][i].empty())
+                    read_right[r]=0;
+                }
+              }
+            }));
+      for(auto &reader: readers)
+        reader.join();
+      if (count(read_right.begin(), read_right.end(), 0)){
+        TERMINATE("Wrong lists read from a graph placed on "+ItoA(nodes)+" nodes");
+      }
+    }
+  placed_g.Reorder(kDegreeOrder);
+  if (placed_g.GetNumaPlacement() != kNumaFirstTouch || placed_g.GetNumaNodes() != 1){
+    TERMINATE("Reordering kept the placement of a partitioned graph");
+  }
+  //
+
+  //check that edge list ids an int cannot hold are refused, not wrapped
+  if (!EdgeListRefused(name+".edges", "4294967297 2\n") || !EdgeListRefused(name+".edges", "2147483648 0\n") ||
+      !EdgeListRefused(name+".edges", "-1 0\n") ||
+      !EdgeListRefused(name+".edges", "%%MatrixMarket matrix coordinate pattern general\n3 3 1\n-2147483648 1\n") ||
+      !EdgeListRefused(name+".edges", "12345678901234567890 1\n") ||
+      !EdgeListRefused(name+".edges", "3 99999999999999999999\n", kSparseIds) ||
+      !EdgeListRefused(name+".edges", "%%MatrixMarket matrix coordinate pattern general\n100000000000000000000 3 1\n1 2\n")){
+    TERMINATE("An edge list with an out of range id was loaded");
+  }
+  //
+
+  //check the parallel parse of text against a serial one, on a file long
+  //enough that every chunk boundary falls inside a line or a number
+  {
+    ofstream numbers_stream(name+".numbers");
+    for(int i=0; i<300000; i++){
+      numbers_stream<<( rand()%2 ? "-" : "" )<<rand();
+      numbers_stream<<( i%7 ? " " : ( i%3 ? "\n" : "\r\n" ) );
+    }
+    numbers_stream<<endl;
+  }
+  ifstream serial_stream(name+".numbers");
+  vector<long long> serial, parallel(300000);
+  for(long long x; serial_stream>>x; )
+    serial.push_back(x);
+  TextParser::ParseFile<long long>(name+".numbers", parallel.size(), parallel.data(), 0);
+  if (parallel != serial){
+    TERMINATE("Parallel parse of "+name+".numbers differs from a serial one");
+  }
+  vector<int> prefix(1000 + t);
+  TextParser::ParseFile<int>(name+".numbers", prefix.size(), prefix.data(), 0);
+  if (!equal(prefix.begin(), prefix.end(), serial.begin())){
+    TERMINATE("Parallel parse of a prefix of "+name+".numbers differs from a serial one");
+  }
+  //the same numbers two by two as edges, a line a chunk boundary cuts must
+  //come out once and whole
+  {
+    ofstream pairs_stream(name+".pairs");
+    for(size_t i=0; i+1<serial.size(); i+=2)
+      pairs_stream<<llabs(serial[i])%100000<<( i%4 ? "\t" : " " )<<llabs(serial[i+1])%100000<<endl;
+  }
+  vector<int> pair_sources, pair_targets;
+  TextParser::ParseEdgeFile(name+".pairs", pair_sources, pair_targets, 0);
+  bool pairs_match=pair_sources.size() == serial.size()/2;
+  for(size_t i=0; pairs_match && i<pair_sources.size(); i++)
+    pairs_match=pair_sources[i] == llabs(serial[2*i])%100000 && pair_targets[i] == llabs(serial[2*i+1])%100000;
+  if (!pairs_match){
+    TERMINATE("Parallel parse of "+name+".pairs differs from a serial one");
+  }
+  //
+
+  //check the blocked transpose against a naive one on enough vertices for
+  //several destination buckets, from plain, 64-bit and compressed OUT
+  int parameters[]={0, kWideOffsets};
+  for(int i=0; i<3; i++){
+    BasicGraph reversed_g(0);
+    reversed_g.GenerateErdosRenyiGraph(100000 + t, 400000, t, parameters[i%2]);
+    if (i == 2)
+      reversed_g.Compress(OUT);
+    if (!TransposedGraph(reversed_g)){
+      TERMINATE("Wrong blocked transpose of "+ItoA(reversed_g.GetNumberVertex())+" vertices");
+    }
+  }
+  //
+
+  //check StreamVByte on its own: every length around the groups of four,
+  //deltas of every byte length both ways, sorted lists and unsorted ones
+  for(int count=0; count<40; count++){
+    vector<int> values(count);
+    for(int i=0; i<count; i++){
+      int bytes=rand()%4;
+      values[i]=( rand()%2 ? -1 : 1 ) * static_cast<int>( rand() & ( ( 1U << ( 8 * bytes + 7 ) ) - 1 ) );
+    }
+    if (count>2){
+      values[0]=INT_MIN;
+      values[1]=INT_MAX;
+    }
+    for(int sorted=0; sorted<2; sorted++){
+      if (sorted)
+        sort(values.begin(), values.end());
+      vector<unsigned char> encoded(StreamVByte::EncodedSize(values.data(), count, sorted) + StreamVByte::kPadding);
+      size_t size=StreamVByte::Encode(values.data(), count, sorted, encoded.data());
+      vector<int> decoded(count), iterated;
+      StreamVByte::Decode(encoded.data(), count, sorted, decoded.data());
+      for(NeighborIterator it(encoded.data(), count, sorted); it.HasNext(); )
+        iterated.push_back(it.Next());
+      if (size + StreamVByte::kPadding != encoded.size() || decoded != values || iterated != values){
+        TERMINATE("Wrong StreamVByte round trip of "+ItoA(count)+" values");
+      }
+    }
+  }
+  //
+
+  //check the lists of compressed views, on ids far enough apart to take
+  //several bytes
+  BasicGraph sparse_er_g(0);
+  sparse_er_g.GenerateErdosRenyiGraph(1 << 20, 1 << 14, t);
+  vector<vector<int> > sparse_er_edge(sparse_er_g.GetNumberVertex());
+  for(int i=0; i<sparse_er_g.GetNumberVertex(); i++)
+    sparse_er_edge[i]=sparse_er_g.GetNeighbors(i);
+  sparse_er_g.Compress(OUT);
+  if (!sparse_er_g.IsCompressed(OUT) || !DecodedGraph(sparse_er_g, OUT, sparse_er_edge)){
+    TERMINATE("Wrong lists of a compressed sparse graph");
+  }
+  sparse_er_g.Decompress(OUT);
+  TestGraph(t, "decompressed", sparse_er_g, OUT, sparse_er_edge);
+  //
+
+  //check the views derived from and saved out of a compressed OUT
+  BasicGraph compressed_g(0);
+  compressed_g.Load("test"+ItoA(t));
+  compressed_g.Compress(OUT);
+  TestGraph(t, "compressed", compressed_g, UNION, edge_union);
+  TestGraph(t, "compressed", compressed_g, INTERSECTION, edge_inter);
+  TestGraph(t, "compressed", compressed_g, IN, edge_in);
+  if (!DecodedGraph(compressed_g, OUT, edge)){
+    TERMINATE("Wrong decoded lists of compressed OUT");
+  }
+  //the copies of a replicated compressed view are read encoded
+  compressed_g.PlaceOnNodes(kNumaReplicate, 3);
+  TestGraph(t, "compressed", compressed_g, OUT, edge);
+  if (!compressed_g.IsCompressed(OUT) || !DecodedGraph(compressed_g, OUT, edge)){
+    TERMINATE("Wrong decoded lists of replicated compressed OUT");
+  }
+  compressed_g.PlaceOnNodes(kNumaFirstTouch);
+  compressed_g.Save("compressed", kALL);
+  BasicGraph decompressed_g(0);
+  decompressed_g.Load("compressed");
+  TestGraph(t, "compressed.imp_out", decompressed_g, OUT, edge);
+  compressed_g.Compress(IN);
+  compressed_g.Reorder(kRCMOrder);
+  if (!compressed_g.IsCompressed(OUT) || !compressed_g.IsCompressed(IN)){
+    TERMINATE("Reordering decompressed a view");
+  }
+  for(int i=0; i<n; i++){
+    vector<long long> raw_neighbor=compressed_g.ToRawIds(compressed_g.GetNeighbors(i, OUT));
+    vector<int> neighbor(raw_neighbor.begin(), raw_neighbor.end());
+    sort(neighbor.begin(), neighbor.end());
+    if (neighbor != edge[compressed_g.ToRawId(i)]){
+      TERMINATE("Wrong neighbors for raw node "+ItoA(compressed_g.ToRawId(i))+" of a compressed graph after reordering");
+    }
+  }
+  //
+
+  //check that the descriptors of a message holding more than one are closed
+  int sockets[2];
+  socketpair(AF_UNIX, SOCK_STREAM, 0, sockets);
+  int before=OpenDescriptors();
+  int extra[2] = { sockets[0], sockets[1] };
+  SendDescriptors(sockets[0], extra, 2);
+  MemfdGraph refused_g;
+  if (refused_g.Receive(sockets[1]) != LoadingWrongSocket || OpenDescriptors() != before){
+    TERMINATE("A message with two descriptors was taken or leaked them");
+  }
+  close(sockets[0]);
+  close(sockets[1]);
+  //
+
+  //check that RMAT graphs depend on the seed only and are cleaned as asked
+  RMATOptions rmat_options;
+  rmat_options.scale=8;
+  rmat_options.noise=0.1;
+  rmat_options.seed=t;
+  BasicGraph rmat_g(0), same_rmat_g(0), loops_rmat_g(0);
+  rmat_g.GenerateRMATGraph(rmat_options, kDeduplicate+kNoSelfLoops);
+  same_rmat_g.GenerateRMATGraph(rmat_options, kDeduplicate+kNoSelfLoops);
+  if (!SameGraph(rmat_g, same_rmat_g) || !CleanGraph(rmat_g, 0) || rmat_g.GetNumerEdges() == 0){
+    TERMINATE("Wrong RMAT graph of seed "+ItoA(t));
+  }
+  loops_rmat_g.GenerateRMATGraph(rmat_options, 0);
+  if (loops_rmat_g.GetNumerEdges() != llround(rmat_options.edge_factor * ( 1 << rmat_options.scale )) ||
+      loops_rmat_g.GetNumerEdges() < rmat_g.GetNumerEdges()){
+    TERMINATE("Wrong edge count of uncleaned RMAT graph");
+  }
+  rmat_options.seed=t + 1000;
+  same_rmat_g.GenerateRMATGraph(rmat_options, kDeduplicate+kNoSelfLoops);
+  if (SameGraph(rmat_g, same_rmat_g)){
+    TERMINATE("Two seeds gave the same RMAT graph");
+  }
+  //
+
+  //check the other generators: same seed same graph, exact edge counts where
+  //they are known, and duplicates and self-loops handled as asked
+  BasicGraph generated_g(0), same_generated_g(0);
+  generated_g.GenerateErdosRenyiGraph(50, 300, t);
+  same_generated_g.GenerateErdosRenyiGraph(50, 300, t);
+  if (!SameGraph(generated_g, same_generated_g) || !CleanGraph(generated_g, 0) || generated_g.GetNumerEdges() == 0){
+    TERMINATE("Wrong Erdos-Renyi graph of seed "+ItoA(t));
+  }
+  generated_g.GenerateBarabasiAlbertGraph(60, 3, t);
+  same_generated_g.GenerateBarabasiAlbertGraph(60, 3, t);
+  vector<int> first_neighbor=generated_g.GetNeighbors(0);
+  if (!SameGraph(generated_g, same_generated_g) || !CleanGraph(generated_g, 1) || !SymmetricGraph(generated_g) ||
+      !binary_search(first_neighbor.begin(), first_neighbor.end(), 0)){
+    TERMINATE("Wrong Barabasi-Albert graph of seed "+ItoA(t));
+  }
+  generated_g.GenerateBarabasiAlbertGraph(60, 3, t, kDeduplicate+kNoSelfLoops);
+  if (!CleanGraph(generated_g, 0) || !SymmetricGraph(generated_g)){
+    TERMINATE("Self-loops left in Barabasi-Albert graph of seed "+ItoA(t));
+  }
+  generated_g.GenerateWattsStrogatzGraph(40, 6, 0, t);
+  if (generated_g.GetNumerEdges() != 40 * 6){
+    TERMINATE("Wrong edge count of ring lattice");
+  }
+  for(int i=0; i<40; i++){
+    vector<int> expected;
+    for(int j=1; j<=3; j++){
+      expected.push_back(( i + j ) % 40);
+      expected.push_back(( i + 40 - j ) % 40);
+    }
+    sort(expected.begin(), expected.end());
+    if (generated_g.GetNeighbors(i) != expected){
+      TERMINATE("Wrong neighbors of node "+ItoA(i)+" of ring lattice");
+    }
+  }
+  generated_g.GenerateWattsStrogatzGraph(40, 6, 0.3, t);
+  same_generated_g.GenerateWattsStrogatzGraph(40, 6, 0.3, t);
+  if (!SameGraph(generated_g, same_generated_g) || !CleanGraph(generated_g, 0) || !SymmetricGraph(generated_g) ||
+      generated_g.GetNumerEdges() > 40 * 6){
+    TERMINATE("Wrong Watts-Strogatz graph of seed "+ItoA(t));
+  }
+  //4 * 3 * 2 vertices, (3 * 3 * 2 + 4 * 2 * 2 + 4 * 3 * 1) edges, 24 more along
+  //each of x and y on the torus, z is too short to wrap
+  generated_g.GenerateGridGraph(4, 3, 2);
+  if (generated_g.GetNumberVertex() != 24 || generated_g.GetNumerEdges() != 2 * 46 ||
+      !CleanGraph(generated_g, 0) || !SymmetricGraph(generated_g)){
+    TERMINATE("Wrong grid graph");
+  }
+  generated_g.GenerateGridGraph(4, 3, 2, 1);
+  if (generated_g.GetNumerEdges() != 2 * 60 || !CleanGraph(generated_g, 0) || !SymmetricGraph(generated_g)){
+    TERMINATE("Wrong torus graph");
+  }
+  vector<int> block_sizes;
+  block_sizes.push_back(5);
+  block_sizes.push_back(7);
+  vector<double> probabilities(4, 0);
+  probabilities[0]=probabilities[3]=1;
+  generated_g.GenerateStochasticBlockGraph(block_sizes, probabilities, t);
+  for(int i=0; i<12; i++){
+    vector<int> expected;
+    for(int j=( i<5 ? 0 : 5 ); j<( i<5 ? 5 : 12 ); j++)
+      if (j != i)
+        expected.push_back(j);
+    if (generated_g.GetNeighbors(i) != expected){
+      TERMINATE("Wrong neighbors of node "+ItoA(i)+" of two cliques");
+    }
+  }
+  probabilities[0]=probabilities[3]=0.5;
+  probabilities[1]=probabilities[2]=0.1;
+  generated_g.GenerateStochasticBlockGraph(block_sizes, probabilities, t);
+  same_generated_g.GenerateStochasticBlockGraph(block_sizes, probabilities, t);
+  if (!SameGraph(generated_g, same_generated_g) || !CleanGraph(generated_g, 0) || !SymmetricGraph(generated_g)){
+    TERMINATE("Wrong stochastic block graph of seed "+ItoA(t));
+  }
+  //
+
+  //check that every order relabels the same edges in every view, also when
+  //one order follows another
+  VertexOrder orders[]={kDegreeOrder, kRCMOrder, kGorder};
+  BasicGraph ordered_g(0);
+  ordered_g.Load("test"+ItoA(t));
+  for(int i=0; i<3; i++){
+    ordered_g.Reorder(orders[i]);
+    if (!RawGraph(ordered_g, OUT, edge) || !RawGraph(ordered_g, IN, edge_in) ||
+        !RawGraph(ordered_g, INTERSECTION, edge_inter) || !RawGraph(ordered_g, UNION, edge_union) ||
+        ordered_g.GetNumerEdges() != m){
+      TERMINATE("Wrong edges after vertex order "+ItoA(orders[i]));
+    }
+    for(int j=1; orders[i] == kDegreeOrder && j<n; j++)
+      if (ordered_g.GetDegree(j-1) < ordered_g.GetDegree(j)){
+        TERMINATE("Degree order left node "+ItoA(j)+" of a higher degree behind");
+      }
+  }
+  vector<int> permutation(n);
+  for(int i=0; i<n; i++)
+    permutation[i]=i;
+  random_shuffle(permutation.begin(), permutation.end());
+  BasicGraph permuted_g(0);
+  permuted_g.Load("test"+ItoA(t));
+  permuted_g.Reorder(permutation);
+  for(int i=0; i<n; i++)
+    if (permuted_g.ToRawId(i) != permutation[i]){
+      TERMINATE("An explicit order did not put old node "+ItoA(permutation[i])+" at "+ItoA(i));
+    }
+  if (!RawGraph(permuted_g, OUT, edge) || !RawGraph(permuted_g, UNION, edge_union)){
+    TERMINATE("Wrong edges after an explicit order");
+  }
+  //
+
+  //check reordering
+  my_g.Reorder(kGorder);
+  for(int i=0; i<n; i++){
+    vector<long long> raw_neighbor=my_g.ToRawIds(my_g.GetNeighbors(i, IN));
+    if (my_g.FromRawIds(raw_neighbor) != my_g.GetNeighbors(i, IN)){
+      TERMINATE("Wrong raw id mapping of node "+ItoA(i)+" after reordering");
+    }
+    vector<int> neighbor(raw_neighbor.begin(), raw_neighbor.end());
+    sort(neighbor.begin(), neighbor.end());
+    int raw_id=my_g.ToRawId(i);
+    if (neighbor != edge_in[raw_id]){
+      TERMINATE("Wrong neighbors for raw node "+ItoA(raw_id)+" after reordering");
+    }
+  }
+  //
+
+  //check induced subgraph on the raw ids not divisible by 3
+  vector<int> subgraph_ids;
+  for(int i=0; i<n; i++)
+    if (i%3)
+      subgraph_ids.push_back(i);
+  BasicGraph sub_g(my_g, subgraph_ids);
+  if (sub_g.GetNumberVertex() != static_cast<int>(subgraph_ids.size())){
+    TERMINATE("Wrong vertex count of induced subgraph");
+  }
+  for(int i=0; i<sub_g.GetNumberVertex(); i++){
+    vector<long long> raw_neighbor=sub_g.ToRawIds(sub_g.GetNeighbors(i, UNION));
+    vector<int> neighbor(raw_neighbor.begin(), raw_neighbor.end()), expected;
+    sort(neighbor.begin(), neighbor.end());
+    int raw_id=sub_g.ToRawId(i);
+    for(auto j: edge_union[raw_id])
+      if (j%3)
+        expected.push_back(j);
+    if (neighbor != expected){
+      TERMINATE("Wrong neighbors for raw node "+ItoA(raw_id)+" of induced subgraph");
+    }
+  }
+  //
+
+  //check induced subgraph of a sparse graph on keys past INT_MAX
+  ofstream(name+".sparse")<<"5000000000 7\n7 9000000000\n9000000000 5000000000\n3 7\n";
+  BasicGraph sparse_g(0);
+  sparse_g.LoadEdgeList(name+".sparse", kSparseIds);
+  vector<long long> sparse_ids;
+  sparse_ids.push_back(9000000000LL);
+  sparse_ids.push_back(5000000000LL);
+  BasicGraph sparse_sub_g(sparse_g, sparse_ids);
+  if (sparse_sub_g.GetNumberVertex() != 2 || sparse_sub_g.GetNumerEdges() != 1 ||
+      sparse_sub_g.ToRawIds(sparse_sub_g.GetNeighbors(sparse_sub_g.FromRawId(9000000000LL))) != vector<long long>(1, 5000000000LL)){
+    TERMINATE("Wrong induced subgraph on 64-bit raw ids");
+  }
+  //
+
+  //check background loading
+  BasicGraph async_g(0);
+  shared_future<void> loading = async_g.LoadAsync(name);
+  TestGraph(t, name+kContainerSuffix, async_g, IN, edge_in);
+  loading.get();
+  TestGraph(t, name+kContainerSuffix, async_g, OUT, edge);
+  //
+
   test_process.Stop();
 
-  system( string("rm -f "+name+".*").c_str() );
+  system( string("rm -f "+name+".* compressed.*").c_str() );
   system("rm -f result.*");
 }
 
 int main(){
 
+  atexit(RemoveSegments);
+
   while(1){
     cout<<"srand(time)? Y/N";
     string s;
@@ -6,6 +6,10 @@
 #include <string>
 #include <iomanip>
 #include <chrono>
+#include <thread>
+#include <vector>
+#include <stdexcept>
+#include <exception>
 
 const int default_step=1;
 
@@ -99,6 +103,77 @@ class mProcess{
 
 };
 
+class mParallel{
+
+ public:
+
+  static int Threads(){
+    int threads = std::thread::hardware_concurrency();
+    return threads > 0 ? threads : 1;
+  }
+
+  //calls func(thread_id) on threads threads and waits for all of them,
+  //the first exception thrown by any of them is rethrown here
+  template<class F>
+  static void Run(int threads, F func){
+    if (threads <= 1){
+      func(0);
+      return;
+    }
+    std::vector<std::exception_ptr> errors(threads);
+    auto guarded = [&](int thread_id){
+      try{
+        func(thread_id);
+      }catch(...){
+        errors[thread_id] = std::current_exception();
+      }
+    };
+    std::vector<std::thread> workers;
+    for(int i=1; i<threads; i++)
+      workers.push_back( std::thread(guarded, i) );
+    guarded(0);
+    for(auto &worker: workers)
+      worker.join();
+    for(auto &error: errors)
+      if (error)
+        std::rethrow_exception(error);
+  }
+
+  //calls func(thread_id, block_begin, block_end) on contiguous blocks of [begin, end)
+  template<class F>
+  static void For(long long begin, long long end, F func, int threads = 0){
+    if (threads <= 0)
+      threads = Threads();
+    long long total = end - begin;
+    if (total < threads)
+      threads = total > 0 ? total : 1;
+    Run(threads, [&](int thread_id){
+        func(thread_id, begin + total * thread_id / threads, begin + total * ( thread_id + 1 ) / threads);
+      });
+  }
+
+  //in-place inclusive prefix sum, every block is summed twice so that the threads never wait on each other
+  template<class T>
+  static void PrefixSum(T *array, long long size){
+    int threads = Threads();
+    std::vector<T> block_sums(threads + 1, 0);
+    For(0, size, [&](int thread_id, long long begin, long long end){
+        T sum = 0;
+        for(long long i = begin; i < end; i++)
+          sum += array[i];
+        block_sums[thread_id + 1] = sum;
+      }, threads);
+    for(int i = 0; i < threads; i++)
+      block_sums[i + 1] += block_sums[i];
+    For(0, size, [&](int thread_id, long long begin, long long end){
+        T sum = block_sums[thread_id];
+        for(long long i = begin; i < end; i++)
+          array[i] = ( sum += array[i] );
+      }, threads);
+  }
+
+};
+
 class FilePath {
   
  public: